@@ -0,0 +1,17 @@
+#include "CounterBasedRandom.h"
+
+
+CounterBasedRandom::CounterBasedRandom(uint64_t seed)
+	: mSeed{ seed }
+{
+}
+
+uint64_t CounterBasedRandom::seed() const
+{
+	return mSeed;
+}
+
+void CounterBasedRandom::setSeed(uint64_t seed)
+{
+	mSeed = seed;
+}
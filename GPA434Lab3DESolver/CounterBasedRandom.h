@@ -0,0 +1,114 @@
+#pragma once
+#ifndef COUNTER_BASED_RANDOM_H
+#define COUNTER_BASED_RANDOM_H
+
+
+#include <array>
+#include <cstdint>
+#include <cstddef>
+
+
+//! \brief Générateur de nombres aléatoires basé sur un compteur (Philox4x32-10).
+//!
+//! \details Contrairement à `std::default_random_engine`, ce générateur ne
+//! possède aucun état mutable : chaque tirage est une fonction pure de la
+//! clé (le germe) et d'un compteur. Le compteur est construit à partir de la
+//! génération, de l'individu, du gène et d'un flux identifiant l'usage du
+//! tirage (échantillonnage des donneurs, croisement, etc.).
+//!
+//! Ainsi, n'importe quel fil d'exécution peut obtenir exactement les mêmes
+//! nombres que l'exécution séquentielle, sans synchronisation. Une simulation
+//! utilisant 1 ou 64 fils d'exécution donne des résultats identiques au bit
+//! près.
+//!
+//! Les fonctions de tirage sont définies dans l'entête afin d'être intégrées
+//! (_inline_) dans les boucles des stratégies.
+class CounterBasedRandom
+{
+public:
+	using Block = std::array<uint32_t, 4>;
+
+	CounterBasedRandom(uint64_t seed = 0);										//!< Constructeur avec initialisation du germe.
+	CounterBasedRandom(CounterBasedRandom const &) = default;					//!< Constructeur de copie.
+	CounterBasedRandom(CounterBasedRandom &&) = default;						//!< Constructeur de déplacement.
+	CounterBasedRandom& operator=(CounterBasedRandom const &) = default;		//!< Opérateur d'assignation de copie.
+	CounterBasedRandom& operator=(CounterBasedRandom &&) = default;				//!< Opérateur d'assignation de déplacement.
+	~CounterBasedRandom() = default;											//!< Destructeur.
+
+	uint64_t seed() const;														//!< Retourne le germe courant.
+	void setSeed(uint64_t seed);												//!< Détermine le germe (la clé du générateur).
+
+	//! \brief Retourne le bloc de 128 bits associé au compteur (generation, stream, individual, gene).
+	Block block(uint32_t generation, uint32_t stream, uint32_t individual, uint32_t gene) const;
+	//! \brief Retourne 64 bits aléatoires associés au compteur. Le paramètre `half` (0 ou 1) choisit la moitié du bloc.
+	uint64_t bits(uint32_t generation, uint32_t stream, uint32_t individual, uint32_t gene, size_t half = 0) const;
+	//! \brief Retourne un nombre réel uniforme dans l'intervalle [0, 1[ (53 bits de précision).
+	double uniform(uint32_t generation, uint32_t stream, uint32_t individual, uint32_t gene) const;
+	//! \brief Retourne un nombre réel uniforme dans l'intervalle [lower, upper[.
+	double uniform(double lower, double upper, uint32_t generation, uint32_t stream, uint32_t individual, uint32_t gene) const;
+	//! \brief Retourne un entier uniforme dans l'intervalle [0, bound[ (bound < 2^32). Retourne 0 si bound vaut 0.
+	size_t index(size_t bound, uint32_t generation, uint32_t stream, uint32_t individual, uint32_t gene) const;
+
+	static double toUnit(uint64_t bits);										//!< Convertit 64 bits aléatoires en un réel uniforme dans [0, 1[.
+
+private:
+	uint64_t mSeed;
+
+	static constexpr uint32_t sMultiplier0{ 0xD2511F53u };
+	static constexpr uint32_t sMultiplier1{ 0xCD9E8D57u };
+	static constexpr uint32_t sWeyl0{ 0x9E3779B9u };
+	static constexpr uint32_t sWeyl1{ 0xBB67AE85u };
+	static constexpr size_t sRoundCount{ 10 };
+};
+
+
+
+inline CounterBasedRandom::Block CounterBasedRandom::block(uint32_t generation, uint32_t stream, uint32_t individual, uint32_t gene) const
+{
+	Block counter{ generation, stream, individual, gene };
+	uint32_t key0{ static_cast<uint32_t>(mSeed) };
+	uint32_t key1{ static_cast<uint32_t>(mSeed >> 32) };
+
+	for (size_t round{}; round < sRoundCount; ++round) {
+		uint64_t const product0{ static_cast<uint64_t>(sMultiplier0) * counter[0] };
+		uint64_t const product1{ static_cast<uint64_t>(sMultiplier1) * counter[2] };
+		counter = Block{ static_cast<uint32_t>(product1 >> 32) ^ counter[1] ^ key0,
+						 static_cast<uint32_t>(product1),
+						 static_cast<uint32_t>(product0 >> 32) ^ counter[3] ^ key1,
+						 static_cast<uint32_t>(product0) };
+		key0 += sWeyl0;
+		key1 += sWeyl1;
+	}
+
+	return counter;
+}
+
+inline uint64_t CounterBasedRandom::bits(uint32_t generation, uint32_t stream, uint32_t individual, uint32_t gene, size_t half) const
+{
+	Block const b{ block(generation, stream, individual, gene) };
+	size_t const offset{ (half & 1) * 2 };
+	return (static_cast<uint64_t>(b[offset]) << 32) | b[offset + 1];
+}
+
+inline double CounterBasedRandom::toUnit(uint64_t bits)
+{
+	return static_cast<double>(bits >> 11) * 0x1.0p-53;
+}
+
+inline double CounterBasedRandom::uniform(uint32_t generation, uint32_t stream, uint32_t individual, uint32_t gene) const
+{
+	return toUnit(bits(generation, stream, individual, gene));
+}
+
+inline double CounterBasedRandom::uniform(double lower, double upper, uint32_t generation, uint32_t stream, uint32_t individual, uint32_t gene) const
+{
+	return lower + (upper - lower) * uniform(generation, stream, individual, gene);
+}
+
+inline size_t CounterBasedRandom::index(size_t bound, uint32_t generation, uint32_t stream, uint32_t individual, uint32_t gene) const
+{
+	return static_cast<size_t>(((bits(generation, stream, individual, gene) >> 32) * static_cast<uint64_t>(bound)) >> 32);
+}
+
+
+#endif // COUNTER_BASED_RANDOM_H
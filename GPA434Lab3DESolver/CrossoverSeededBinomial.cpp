@@ -0,0 +1,55 @@
+#include "CrossoverSeededBinomial.h"
+
+
+#include <algorithm>
+#include <Population.h>
+#include "SolutionData.h"
+#include "GeneKernels.h"
+
+
+static const std::string csb_title("Binomial reproductible");
+static const std::string csb_summary("Croisement binomial par masque de bits à partir d'un germe.");
+static const std::string csb_description("Chaque gène provient du mutant avec une probabilité CR, et un gène tiré au hasard en provient toujours. Le masque de croisement est tiré en bloc par un générateur à compteur puis appliqué par instructions vectorielles; le croisement est reproductible pour un même germe.");
+
+
+CrossoverSeededBinomial::CrossoverSeededBinomial(double crossoverRate, uint64_t seed)
+	: CrossoverStrategy(csb_title, csb_summary, csb_description, crossoverRate)
+	, SeededStrategy(seed)
+{
+}
+
+void CrossoverSeededBinomial::process(de::Population const & actualPopulation, de::Population const & mutantPopulation, de::Population & trialPopulation)
+{
+	// a 32-bit draw is below the threshold with probability CR (CR = 1 gives 2^32: always true)
+	uint64_t const threshold{ static_cast<uint64_t>(crossoverRate() * 4294967296.0) };
+	size_t const populationSize{ std::min({ actualPopulation.size(), mutantPopulation.size(), trialPopulation.size() }) };
+
+	for (size_t i{}; i < populationSize; ++i) {
+		de::Solution & trial{ trialPopulation[i] };
+		size_t const dimension{ trial.size() };
+		if (dimension == 0) {
+			continue;
+		}
+
+		uint32_t const individual{ static_cast<uint32_t>(i) };
+		mMask.assign((dimension + 63) / 64, 0);
+		for (size_t block{}; block * 4 < dimension; ++block) {
+			CounterBasedRandom::Block const draws{ random().block(generation(), sStream, individual, static_cast<uint32_t>(block)) };
+			size_t const first{ block * 4 };
+			uint64_t bits{};
+			for (size_t k{}; k < 4; ++k) {
+				bits |= static_cast<uint64_t>(draws[k] < threshold) << k;
+			}
+			// 4 divides 64: the 4 bits never straddle two words
+			mMask[first / 64] |= bits << (first % 64);
+		}
+		// bits past the dimension are left set: GeneKernels::blend ignores them
+
+		size_t const forcedGene{ random().index(dimension, generation(), sForcedGeneStream, individual, 0) };
+		mMask[forcedGene / 64] |= uint64_t{ 1 } << (forcedGene % 64);
+
+		GeneKernels::blend(solutionData(trial), solutionData(actualPopulation[i]), solutionData(mutantPopulation[i]), mMask.data(), dimension);
+	}
+
+	nextGeneration();
+}
@@ -0,0 +1,45 @@
+#pragma once
+#ifndef CROSSOVER_SEEDED_BINOMIAL_H
+#define CROSSOVER_SEEDED_BINOMIAL_H
+
+
+#include <vector>
+#include <CrossoverStrategy.h>
+#include "SeededStrategy.h"
+
+
+//! \brief Stratégie de croisement binomial reproductible, par masque de bits.
+//!
+//! \details Chaque gène de l'essai provient du mutant avec une probabilité 
+//! CR, et de la cible sinon. Un gène \f$j_{rand}\f$ tiré au hasard provient 
+//! toujours du mutant.
+//!
+//! C'est la même règle que `de::CrossoverBinomial`, mais :
+//!  - le masque de croisement d'un individu est construit en bloc : chaque 
+//!    appel du générateur à compteur fournit 4 tirages de 32 bits, comparés 
+//!    à \f$CR \cdot 2^{32}\f$, sans branchement par gène;
+//!  - l'essai est ensuite assemblé par GeneKernels::blend, qui mélange les 
+//!    rangées de la cible et du mutant par instructions vectorielles masquées.
+class CrossoverSeededBinomial : public de::CrossoverStrategy, public SeededStrategy
+{
+public:
+	CrossoverSeededBinomial(double crossoverRate = 0.75, uint64_t seed = 0);			//!< Constructeur avec initialisation du taux de croisement et du germe.
+	CrossoverSeededBinomial(CrossoverSeededBinomial const &) = default;					//!< Constructeur de copie.
+	CrossoverSeededBinomial(CrossoverSeededBinomial &&) = default;						//!< Constructeur de déplacement.
+	CrossoverSeededBinomial& operator=(CrossoverSeededBinomial const &) = default;		//!< Opérateur d'assignation de copie.
+	CrossoverSeededBinomial& operator=(CrossoverSeededBinomial &&) = default;			//!< Opérateur d'assignation de déplacement.
+	~CrossoverSeededBinomial() override = default;										//!< Destructeur.
+
+	void process(de::Population const & actualPopulation, de::Population const & mutantPopulation, de::Population & trialPopulation) override; //!< Effectue le croisement.
+
+	DEFINE_OVERRIDE_CLONE_METHOD(CrossoverSeededBinomial)								//!< Macro définissant automatiquement la substitution de la méthode de clonage.
+
+private:
+	std::vector<uint64_t> mMask;														// masque d'un individu, conservé pour éviter une allocation à chaque génération
+
+	static constexpr uint32_t sStream{ 0x42494E4Fu };
+	static constexpr uint32_t sForcedGeneStream{ 0x4A524E44u };
+};
+
+
+#endif // CROSSOVER_SEEDED_BINOMIAL_H
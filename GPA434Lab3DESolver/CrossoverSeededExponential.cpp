@@ -0,0 +1,60 @@
+#include "CrossoverSeededExponential.h"
+
+
+#include <algorithm>
+#include <cmath>
+#include <Population.h>
+#include "SolutionData.h"
+
+
+static const std::string cse_title("Exponentiel reproductible");
+static const std::string cse_summary("Croisement exponentiel à partir d'un germe.");
+static const std::string cse_description("Un bloc de gènes consécutifs, commençant à une position tirée au hasard, provient du mutant. La longueur du bloc suit une loi géométrique de paramètre 1 - CR; elle est tirée en une seule fois par un générateur à compteur, le croisement est donc reproductible pour un même germe.");
+
+
+CrossoverSeededExponential::CrossoverSeededExponential(double crossoverRate, uint64_t seed)
+	: CrossoverStrategy(cse_title, cse_summary, cse_description, crossoverRate)
+	, SeededStrategy(seed)
+{
+}
+
+void CrossoverSeededExponential::process(de::Population const & actualPopulation, de::Population const & mutantPopulation, de::Population & trialPopulation)
+{
+	double const rate{ crossoverRate() };
+	double const logRate{ std::log(rate) };
+	size_t const populationSize{ std::min({ actualPopulation.size(), mutantPopulation.size(), trialPopulation.size() }) };
+
+	for (size_t i{}; i < populationSize; ++i) {
+		de::Solution & trial{ trialPopulation[i] };
+		size_t const dimension{ trial.size() };
+		if (dimension == 0) {
+			continue;
+		}
+
+		uint32_t const individual{ static_cast<uint32_t>(i) };
+		size_t const start{ random().index(dimension, generation(), sStream, individual, 0) };
+
+		// L - 1 is the number of successes (probability CR) before the first failure
+		size_t length{ dimension };
+		if (rate < 1.0) {
+			double const u{ 1.0 - random().uniform(generation(), sStream, individual, 1) };	// in ]0, 1]
+			double const successes{ rate > 0.0 ? std::floor(std::log(u) / logRate) : 0.0 };
+			length = successes < static_cast<double>(dimension - 1) ? 1 + static_cast<size_t>(successes) : dimension;
+		}
+
+		double const * target{ solutionData(actualPopulation[i]) };
+		double const * mutant{ solutionData(mutantPopulation[i]) };
+		double * genes{ solutionData(trial) };
+
+		std::copy(target, target + dimension, genes);
+		size_t const end{ start + length };
+		if (end <= dimension) {
+			std::copy(mutant + start, mutant + end, genes + start);
+		} else {
+			std::copy(mutant + start, mutant + dimension, genes + start);
+			std::copy(mutant, mutant + (end - dimension), genes);
+		}
+	}
+
+	nextGeneration();
+}
@@ -0,0 +1,41 @@
+#pragma once
+#ifndef CROSSOVER_SEEDED_EXPONENTIAL_H
+#define CROSSOVER_SEEDED_EXPONENTIAL_H
+
+
+#include <CrossoverStrategy.h>
+#include "SeededStrategy.h"
+
+
+//! \brief Stratégie de croisement exponentiel reproductible.
+//!
+//! \details À partir d'un gène de départ tiré au hasard, un bloc de 
+//! \f$L\f$ gènes consécutifs (circulairement) provient du mutant; les 
+//! autres proviennent de la cible. \f$L - 1\f$ suit une loi géométrique de 
+//! paramètre \f$1 - CR\f$, bornée à la dimension.
+//!
+//! C'est la même distribution que `de::CrossoverExponential`, mais la 
+//! longueur du bloc est tirée en une seule fois par inversion de la loi 
+//! géométrique : \f$L = 1 + \lfloor \ln u / \ln CR \rfloor\f$, plutôt que 
+//! par un tirage et un branchement par gène. L'essai est ensuite assemblé 
+//! par au plus trois copies contiguës.
+class CrossoverSeededExponential : public de::CrossoverStrategy, public SeededStrategy
+{
+public:
+	CrossoverSeededExponential(double crossoverRate = 0.75, uint64_t seed = 0);			//!< Constructeur avec initialisation du taux de croisement et du germe.
+	CrossoverSeededExponential(CrossoverSeededExponential const &) = default;				//!< Constructeur de copie.
+	CrossoverSeededExponential(CrossoverSeededExponential &&) = default;					//!< Constructeur de déplacement.
+	CrossoverSeededExponential& operator=(CrossoverSeededExponential const &) = default;	//!< Opérateur d'assignation de copie.
+	CrossoverSeededExponential& operator=(CrossoverSeededExponential &&) = default;		//!< Opérateur d'assignation de déplacement.
+	~CrossoverSeededExponential() override = default;										//!< Destructeur.
+
+	void process(de::Population const & actualPopulation, de::Population const & mutantPopulation, de::Population & trialPopulation) override; //!< Effectue le croisement.
+
+	DEFINE_OVERRIDE_CLONE_METHOD(CrossoverSeededExponential)								//!< Macro définissant automatiquement la substitution de la méthode de clonage.
+
+private:
+	static constexpr uint32_t sStream{ 0x4558504Fu };
+};
+
+
+#endif // CROSSOVER_SEEDED_EXPONENTIAL_H
@@ -0,0 +1,55 @@
+#include "DonorSampler.h"
+
+
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+
+
+void DonorSampler::sample(size_t populationSize, std::span<size_t const> excluded, std::span<size_t> donors, CounterBasedRandom const & random, uint32_t generation, uint32_t stream, uint32_t individual)
+{
+	if (excluded.size() > maximumExclusionCount) {
+		throw std::invalid_argument("DonorSampler::sample: too many excluded indices.");
+	}
+
+	// exclusions triées et uniques (la cible peut aussi être la meilleure solution)
+	std::array<size_t, maximumExclusionCount> exclusions{};
+	size_t exclusionCount{};
+	for (size_t index : excluded) {
+		auto const end{ exclusions.begin() + exclusionCount };
+		auto const position{ std::lower_bound(exclusions.begin(), end, index) };
+		if (index < populationSize && (position == end || *position != index)) {
+			std::copy_backward(position, end, end + 1);
+			*position = index;
+			++exclusionCount;
+		}
+	}
+
+	size_t const count{ donors.size() };
+	size_t const available{ populationSize - exclusionCount };
+	if (count > available) {
+		throw std::invalid_argument("DonorSampler::sample: population too small for the requested donors.");
+	}
+
+	// algorithme de Floyd : count indices distincts dans [0, available[ en count tirages
+	uint32_t draw{};
+	for (size_t j{ available - count }, n{}; j < available; ++j, ++n) {
+		size_t const t{ random.index(j + 1, generation, stream, individual, draw++) };
+		bool const alreadyChosen{ std::find(donors.begin(), donors.begin() + n, t) != donors.begin() + n };
+		donors[n] = alreadyChosen ? j : t;
+	}
+
+	// mélange de Fisher-Yates : l'ordre produit par Floyd n'est pas uniforme
+	for (size_t n{ count }; n > 1; --n) {
+		std::swap(donors[n - 1], donors[random.index(n, generation, stream, individual, draw++)]);
+	}
+
+	// projection de [0, available[ vers [0, populationSize[ en sautant les exclusions
+	for (size_t & donor : donors) {
+		for (size_t e{}; e < exclusionCount; ++e) {
+			if (donor >= exclusions[e]) {
+				++donor;
+			}
+		}
+	}
+}
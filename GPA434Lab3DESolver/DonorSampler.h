@@ -0,0 +1,47 @@
+#pragma once
+#ifndef DONOR_SAMPLER_H
+#define DONOR_SAMPLER_H
+
+
+#include <cstdint>
+#include <span>
+#include "CounterBasedRandom.h"
+
+
+//! \brief Échantillonneur d'indices distincts pour le choix des donneurs 
+//! d'une mutation.
+//!
+//! \details Les stratégies de mutation de `delib` construisent, pour chaque 
+//! individu cible, un vecteur de pointeurs vers toutes les solutions de la 
+//! population avant d'en retenir quelques-unes. Le coût est proportionnel à 
+//! la taille de la population pour chaque individu, soit \f$O(N^2)\f$ par 
+//! génération.
+//!
+//! DonorSampler tire directement _k_ indices distincts dans \f$[0, N[\f$ en 
+//! excluant un petit ensemble d'indices (la cible et, au besoin, la 
+//! meilleure solution). L'algorithme de Floyd produit l'ensemble en 
+//! exactement _k_ tirages, puis un mélange de Fisher-Yates rend l'ordre des 
+//! donneurs uniforme (le rôle de chaque donneur dans la formule de mutation 
+//! en dépend). Le coût est \f$O(k)\f$, indépendant de _N_.
+//!
+//! Chaque tirage utilise une position distincte du compteur (le gène) du 
+//! générateur CounterBasedRandom : le résultat ne dépend que de la clé 
+//! (germe, génération, flux, individu).
+class DonorSampler
+{
+public:
+	static constexpr size_t maximumExclusionCount{ 4 };		//!< Nombre maximum d'indices exclus.
+
+	//! \brief Tire `donors.size()` indices distincts dans [0, populationSize[, tous différents de ceux de `excluded`.
+	//! \details Les indices exclus peuvent être répétés (par exemple, la cible est aussi la meilleure solution).
+	//! L'exception std::invalid_argument est lancée si la population est trop petite pour le tirage demandé ou
+	//! s'il y a plus de maximumExclusionCount indices exclus.
+	static void sample(size_t populationSize, 
+					   std::span<size_t const> excluded, 
+					   std::span<size_t> donors, 
+					   CounterBasedRandom const & random, 
+					   uint32_t generation, uint32_t stream, uint32_t individual);
+};
+
+
+#endif // DONOR_SAMPLER_H
@@ -0,0 +1,47 @@
+#pragma once
+#ifndef EVOLUTION_SNAPSHOT_H
+#define EVOLUTION_SNAPSHOT_H
+
+
+#include <string>
+#include <vector>
+#include <Population.h>
+#include "GenerationTiming.h"
+
+
+//! \brief État immuable de l'évolution, publié par QDEAdapter pour 
+//! l'affichage.
+//!
+//! \details Lorsque l'évolution s'exécute sur un fil d'exécution dédié, 
+//! l'engin est modifié en continu et ne peut pas être lu par l'interface. 
+//! Le fil d'évolution copie plutôt l'état à afficher dans un nouvel 
+//! EvolutionSnapshot, partagé en lecture seule (`std::shared_ptr` vers 
+//! un objet constant). Un instantané publié n'est jamais modifié.
+//!
+//! L'instantané transporte aussi les « fitness » de toutes les générations 
+//! dont l'interface n'a pas encore confirmé la réception : aucune 
+//! génération n'est perdue, même si un instantané est remplacé avant 
+//! d'être affiché.
+struct EvolutionSnapshot
+{
+	//! \brief « Fitness » d'une génération.
+	struct FitnessRecord
+	{
+		size_t generation{};											//!< Génération (à partir de 1).
+		double best{};													//!< Meilleure « fitness ».
+		double median{};												//!< « Fitness » médiane.
+		double worst{};													//!< Pire « fitness ».
+	};
+
+
+	size_t generation{};												//!< Génération atteinte.
+	bool stoppingCriteriaReached{};										//!< Indique si un critère d'arrêt est atteint.
+	de::Population population;											//!< Copie de la population actuelle (une seule copie par instantané).
+	std::string bestSolutionInfo;										//!< Description de la meilleure solution (vide avant la première génération).
+	GenerationTiming lastGenerationTiming;								//!< Mesures de la dernière génération.
+	GenerationTiming totalTiming;										//!< Cumul des mesures.
+	std::vector<FitnessRecord> fitness;									//!< « Fitness » des générations non confirmées par l'interface, en ordre chronologique.
+};
+
+
+#endif // EVOLUTION_SNAPSHOT_H
@@ -0,0 +1,119 @@
+#include "FitnessHistory.h"
+
+
+#include <algorithm>
+
+
+FitnessHistory::Envelope const & FitnessHistory::Entry::operator[](Series series) const
+{
+	return values[static_cast<size_t>(series)];
+}
+
+void FitnessHistory::Entry::merge(Entry const & next)
+{
+	for (size_t s{}; s < seriesCount; ++s) {
+		values[s].minimum = std::min(values[s].minimum, next.values[s].minimum);
+		values[s].maximum = std::max(values[s].maximum, next.values[s].maximum);
+		values[s].last = next.values[s].last;
+	}
+	count += next.count;
+}
+
+FitnessHistory::FitnessHistory(size_t recentCapacity, size_t archiveCapacity)
+	: mRecentCapacity{ std::max<size_t>(recentCapacity, 1) }
+	, mArchiveCapacity{ std::max<size_t>(archiveCapacity, 2) }
+{
+	mArchive.reserve(mArchiveCapacity);
+}
+
+void FitnessHistory::add(double best, double median, double worst)
+{
+	Entry entry;
+	entry.generation = mGenerationCount;
+	entry.count = 1;
+	entry.values = { Envelope{ best, best, best }, Envelope{ median, median, median }, Envelope{ worst, worst, worst } };
+
+	double const low{ std::min({ best, median, worst }) };
+	double const high{ std::max({ best, median, worst }) };
+	mMinimum = mGenerationCount == 0 ? low : std::min(mMinimum, low);
+	mMaximum = mGenerationCount == 0 ? high : std::max(mMaximum, high);
+	++mGenerationCount;
+
+	mRecent.push_back(entry);
+	if (mRecent.size() > mRecentCapacity) {
+		archive(mRecent.front());
+		mRecent.pop_front();
+	}
+}
+
+void FitnessHistory::archive(Entry const & entry)
+{
+	// the last archive entry is filled up to the stride before a new one starts
+	if (!mArchive.empty() && mArchive.back().count < mArchiveStride) {
+		mArchive.back().merge(entry);
+		return;
+	}
+
+	if (mArchive.size() == mArchiveCapacity) {
+		// full: halve the resolution by merging the entries pairwise
+		size_t kept{};
+		for (size_t i{}; i < mArchive.size(); i += 2, ++kept) {
+			mArchive[kept] = mArchive[i];
+			if (i + 1 < mArchive.size()) {
+				mArchive[kept].merge(mArchive[i + 1]);
+			}
+		}
+		mArchive.resize(kept);
+		mArchiveStride *= 2;
+
+		if (mArchive.back().count < mArchiveStride) {
+			mArchive.back().merge(entry);
+			return;
+		}
+	}
+
+	mArchive.push_back(entry);
+}
+
+void FitnessHistory::clear()
+{
+	mArchive.clear();
+	mRecent.clear();
+	mArchiveStride = 1;
+	mGenerationCount = 0;
+	mMinimum = 0.0;
+	mMaximum = 0.0;
+}
+
+size_t FitnessHistory::generationCount() const
+{
+	return mGenerationCount;
+}
+
+size_t FitnessHistory::size() const
+{
+	return mArchive.size() + mRecent.size();
+}
+
+FitnessHistory::Entry const & FitnessHistory::operator[](size_t pos) const
+{
+	return pos < mArchive.size() ? mArchive[pos] : mRecent[pos - mArchive.size()];
+}
+
+FitnessHistory::Entry const & FitnessHistory::last() const
+{
+	return mRecent.back();
+}
+
+size_t FitnessHistory::archiveStride() const
+{
+	return mArchiveStride;
+}
+
+void FitnessHistory::getRange(double & xMin, double & xMax, double & yMin, double & yMax) const
+{
+	xMin = 0.0;
+	xMax = mGenerationCount > 0 ? static_cast<double>(mGenerationCount - 1) : 0.0;
+	yMin = mMinimum;
+	yMax = mMaximum;
+}
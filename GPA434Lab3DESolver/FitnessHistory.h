@@ -0,0 +1,94 @@
+#pragma once
+#ifndef FITNESS_HISTORY_H
+#define FITNESS_HISTORY_H
+
+
+#include <array>
+#include <cstddef>
+#include <deque>
+#include <vector>
+
+
+//! \brief Historique des valeurs de « fitness » à mémoire bornée.
+//!
+//! \details `de::History` conserve un objet `de::Statistics` complet par 
+//! génération, soit trois copies de solutions : sa taille croît en 
+//! \f$O(G \cdot D)\f$ sans limite. FitnessHistory ne conserve que les trois 
+//! valeurs affichées (meilleure, médiane et pire « fitness ») et borne le 
+//! nombre d'entrées :
+//!  - les `recentCapacity` dernières générations sont conservées à pleine 
+//!    résolution;
+//!  - les générations plus anciennes sont regroupées dans au plus 
+//!    `archiveCapacity` entrées. Lorsque l'archive est pleine, ses entrées 
+//!    sont fusionnées deux à deux : la résolution des générations anciennes 
+//!    diminue progressivement.
+//!
+//! Chaque entrée conserve, pour chaque série, l'enveloppe (minimum et 
+//! maximum) et la dernière valeur des générations regroupées. Les bornes 
+//! retournées par getRange restent ainsi exactes.
+class FitnessHistory
+{
+public:
+	//! \brief Série de valeurs.
+	enum class Series : size_t
+	{
+		Best,															//!< Meilleure « fitness ».
+		Median,															//!< « Fitness » médiane.
+		Worst															//!< Pire « fitness ».
+	};
+	static constexpr size_t seriesCount{ 3 };							//!< Nombre de séries.
+
+	//! \brief Valeurs d'une série sur les générations d'une entrée.
+	struct Envelope
+	{
+		double minimum{};												//!< Valeur minimale.
+		double maximum{};												//!< Valeur maximale.
+		double last{};													//!< Valeur à la dernière génération.
+	};
+
+	//! \brief Entrée de l'historique, couvrant une ou plusieurs générations consécutives.
+	struct Entry
+	{
+		size_t generation{};											//!< Première génération couverte.
+		size_t count{};													//!< Nombre de générations couvertes.
+		std::array<Envelope, seriesCount> values{};						//!< Valeurs de chaque série.
+
+		Envelope const & operator[](Series series) const;				//!< Retourne les valeurs d'une série.
+		void merge(Entry const & next);									//!< Ajoute les générations de l'entrée suivante.
+	};
+
+	FitnessHistory(size_t recentCapacity = 4096, size_t archiveCapacity = 4096); //!< Constructeur avec les capacités (au moins 1 et 2 entrées).
+	FitnessHistory(FitnessHistory const &) = delete;
+	FitnessHistory(FitnessHistory &&) = default;						//!< Constructeur de déplacement.
+	FitnessHistory& operator=(FitnessHistory const &) = delete;
+	FitnessHistory& operator=(FitnessHistory &&) = default;				//!< Opérateur d'assignation de déplacement.
+	~FitnessHistory() = default;										//!< Destructeur.
+
+	void add(double best, double median, double worst);				//!< Ajoute les valeurs de la génération suivante.
+	void clear();														//!< Vide l'historique.
+
+	size_t generationCount() const;										//!< Retourne le nombre de générations ajoutées.
+	size_t size() const;												//!< Retourne le nombre d'entrées conservées.
+	Entry const & operator[](size_t pos) const;							//!< Retourne l'entrée demandée, en ordre chronologique. Aucune validation des bornes n'est réalisée.
+	Entry const & last() const;											//!< Retourne la dernière entrée (la dernière génération).
+	size_t archiveStride() const;										//!< Retourne le nombre de générations regroupées par entrée de l'archive.
+
+	//! \brief Retourne les limites des données, comme `de::History::getRange` : 
+	//! \f$x\f$ les générations et \f$y\f$ les valeurs de « fitness ». Coût constant.
+	void getRange(double & xMin, double & xMax, double & yMin, double & yMax) const;
+
+private:
+	size_t mRecentCapacity;
+	size_t mArchiveCapacity;
+	size_t mArchiveStride{ 1 };
+	size_t mGenerationCount{};
+	std::vector<Entry> mArchive;
+	std::deque<Entry> mRecent;
+	double mMinimum{};
+	double mMaximum{};
+
+	void archive(Entry const & entry);
+};
+
+
+#endif // FITNESS_HISTORY_H
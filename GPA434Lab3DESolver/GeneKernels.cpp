@@ -0,0 +1,243 @@
+#include "GeneKernels.h"
+
+
+#include <atomic>
+
+#if defined(_M_X64) || defined(__x86_64__)
+#define GENE_KERNELS_X86
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
+// GCC and Clang require the target of each function using wider instructions; MSVC accepts them everywhere.
+// GCC would also fuse the multiplication and the addition into an FMA once AVX-512 is enabled: contraction is disabled.
+#if defined(GENE_KERNELS_X86) && defined(__clang__)
+#define GENE_KERNELS_TARGET(isa) __attribute__((target(isa)))
+#elif defined(GENE_KERNELS_X86) && defined(__GNUC__)
+#define GENE_KERNELS_TARGET(isa) __attribute__((target(isa), optimize("fp-contract=off")))
+#else
+#define GENE_KERNELS_TARGET(isa)
+#endif
+
+
+struct Kernels
+{
+	void (*differential)(double *, double const *, double const *, double const *, double, size_t);
+	void (*blend)(double *, double const *, double const *, uint64_t const *, size_t);
+};
+
+
+static void differentialPortable(double * mutant, double const * base, double const * x1, double const * x2, double f, size_t count)
+{
+	for (size_t j{}; j < count; ++j) {
+		mutant[j] = base[j] + f * (x1[j] - x2[j]);
+	}
+}
+
+static void blendPortable(double * trial, double const * target, double const * mutant, uint64_t const * mask, size_t count)
+{
+	for (size_t j{}; j < count; ++j) {
+		trial[j] = (mask[j / 64] >> (j % 64)) & 1 ? mutant[j] : target[j];
+	}
+}
+
+#ifdef GENE_KERNELS_X86
+
+GENE_KERNELS_TARGET("avx2")
+static void differentialAvx2(double * mutant, double const * base, double const * x1, double const * x2, double f, size_t count)
+{
+	__m256d const factor{ _mm256_set1_pd(f) };
+	size_t j{};
+	for (; j + 4 <= count; j += 4) {
+		__m256d const difference{ _mm256_sub_pd(_mm256_loadu_pd(x1 + j), _mm256_loadu_pd(x2 + j)) };
+		_mm256_storeu_pd(mutant + j, _mm256_add_pd(_mm256_loadu_pd(base + j), _mm256_mul_pd(factor, difference)));
+	}
+	differentialPortable(mutant + j, base + j, x1 + j, x2 + j, f, count - j);
+}
+
+GENE_KERNELS_TARGET("avx512f")
+static void differentialAvx512(double * mutant, double const * base, double const * x1, double const * x2, double f, size_t count)
+{
+	__m512d const factor{ _mm512_set1_pd(f) };
+	size_t j{};
+	for (; j + 8 <= count; j += 8) {
+		__m512d const difference{ _mm512_sub_pd(_mm512_loadu_pd(x1 + j), _mm512_loadu_pd(x2 + j)) };
+		_mm512_storeu_pd(mutant + j, _mm512_add_pd(_mm512_loadu_pd(base + j), _mm512_mul_pd(factor, difference)));
+	}
+	if (j < count) {
+		// masked tail: no scalar loop and no access past the end of the rows
+		__mmask8 const mask{ static_cast<__mmask8>((1u << (count - j)) - 1u) };
+		__m512d const difference{ _mm512_sub_pd(_mm512_maskz_loadu_pd(mask, x1 + j), _mm512_maskz_loadu_pd(mask, x2 + j)) };
+		_mm512_mask_storeu_pd(mutant + j, mask, _mm512_add_pd(_mm512_maskz_loadu_pd(mask, base + j), _mm512_mul_pd(factor, difference)));
+	}
+}
+
+GENE_KERNELS_TARGET("avx2")
+static void blendAvx2(double * trial, double const * target, double const * mutant, uint64_t const * mask, size_t count)
+{
+	// one lane mask per combination of 4 bits: the sign bit selects the mutant in blendv
+	alignas(32) static constexpr int64_t laneMasks[16][4]{
+		{ 0, 0, 0, 0 }, { -1, 0, 0, 0 }, { 0, -1, 0, 0 }, { -1, -1, 0, 0 },
+		{ 0, 0, -1, 0 }, { -1, 0, -1, 0 }, { 0, -1, -1, 0 }, { -1, -1, -1, 0 },
+		{ 0, 0, 0, -1 }, { -1, 0, 0, -1 }, { 0, -1, 0, -1 }, { -1, -1, 0, -1 },
+		{ 0, 0, -1, -1 }, { -1, 0, -1, -1 }, { 0, -1, -1, -1 }, { -1, -1, -1, -1 }
+	};
+
+	size_t j{};
+	for (; j + 4 <= count; j += 4) {
+		unsigned int const bits{ static_cast<unsigned int>(mask[j / 64] >> (j % 64)) & 0xFu };
+		__m256d const select{ _mm256_castsi256_pd(_mm256_load_si256(reinterpret_cast<__m256i const *>(laneMasks[bits]))) };
+		_mm256_storeu_pd(trial + j, _mm256_blendv_pd(_mm256_loadu_pd(target + j), _mm256_loadu_pd(mutant + j), select));
+	}
+	for (; j < count; ++j) {
+		trial[j] = (mask[j / 64] >> (j % 64)) & 1 ? mutant[j] : target[j];
+	}
+}
+
+GENE_KERNELS_TARGET("avx512f")
+static void blendAvx512(double * trial, double const * target, double const * mutant, uint64_t const * mask, size_t count)
+{
+	size_t j{};
+	for (; j + 8 <= count; j += 8) {
+		__mmask8 const select{ static_cast<__mmask8>(mask[j / 64] >> (j % 64)) };
+		_mm512_storeu_pd(trial + j, _mm512_mask_blend_pd(select, _mm512_loadu_pd(target + j), _mm512_loadu_pd(mutant + j)));
+	}
+	if (j < count) {
+		__mmask8 const tail{ static_cast<__mmask8>((1u << (count - j)) - 1u) };
+		__mmask8 const select{ static_cast<__mmask8>(mask[j / 64] >> (j % 64)) };
+		__m512d const blended{ _mm512_mask_blend_pd(select, _mm512_maskz_loadu_pd(tail, target + j), _mm512_maskz_loadu_pd(tail, mutant + j)) };
+		_mm512_mask_storeu_pd(trial + j, tail, blended);
+	}
+}
+
+static bool osSupportsAvx(unsigned long long requiredStates)
+{
+#if defined(_MSC_VER)
+	int info[4]{};
+	__cpuid(info, 1);
+	bool const osxsave{ (info[2] & (1 << 27)) != 0 };
+	return osxsave && (_xgetbv(0) & requiredStates) == requiredStates;
+#else
+	unsigned int eax{}, ebx{}, ecx{}, edx{};
+	__asm__("cpuid" : "=a"(eax), "=b"(ebx), "=c"(ecx), "=d"(edx) : "a"(1), "c"(0));
+	if ((ecx & (1u << 27)) == 0) {
+		return false;
+	}
+	unsigned int low{}, high{};
+	__asm__("xgetbv" : "=a"(low), "=d"(high) : "c"(0));
+	return ((static_cast<unsigned long long>(high) << 32 | low) & requiredStates) == requiredStates;
+#endif
+}
+
+static unsigned int extendedFeatures()
+{
+#if defined(_MSC_VER)
+	int info[4]{};
+	__cpuidex(info, 7, 0);
+	return static_cast<unsigned int>(info[1]);
+#else
+	unsigned int eax{}, ebx{}, ecx{}, edx{};
+	__asm__("cpuid" : "=a"(eax), "=b"(ebx), "=c"(ecx), "=d"(edx) : "a"(7), "c"(0));
+	return ebx;
+#endif
+}
+
+#endif // GENE_KERNELS_X86
+
+
+static Kernels const & kernelsOf(GeneKernels::InstructionSet instructionSet)
+{
+	static Kernels const portable{ differentialPortable, blendPortable };
+#ifdef GENE_KERNELS_X86
+	static Kernels const avx2{ differentialAvx2, blendAvx2 };
+	static Kernels const avx512{ differentialAvx512, blendAvx512 };
+#endif
+
+	switch (instructionSet) {
+#ifdef GENE_KERNELS_X86
+		case GeneKernels::InstructionSet::Avx512:
+			return avx512;
+		case GeneKernels::InstructionSet::Avx2:
+			return avx2;
+#endif
+		case GeneKernels::InstructionSet::Portable:
+		default:
+			return portable;
+	}
+}
+
+static GeneKernels::InstructionSet bestSupported()
+{
+	if (GeneKernels::isSupported(GeneKernels::InstructionSet::Avx512)) return GeneKernels::InstructionSet::Avx512;
+	if (GeneKernels::isSupported(GeneKernels::InstructionSet::Avx2)) return GeneKernels::InstructionSet::Avx2;
+	return GeneKernels::InstructionSet::Portable;
+}
+
+static std::atomic<GeneKernels::InstructionSet> & activeInstructionSet()
+{
+	static std::atomic<GeneKernels::InstructionSet> instructionSet{ bestSupported() };
+	return instructionSet;
+}
+
+
+
+void GeneKernels::differential(double * mutant, double const * base, double const * x1, double const * x2, double f, size_t count)
+{
+	kernelsOf(activeInstructionSet().load(std::memory_order_relaxed)).differential(mutant, base, x1, x2, f, count);
+}
+
+void GeneKernels::blend(double * trial, double const * target, double const * mutant, uint64_t const * mask, size_t count)
+{
+	kernelsOf(activeInstructionSet().load(std::memory_order_relaxed)).blend(trial, target, mutant, mask, count);
+}
+
+bool GeneKernels::isSupported(InstructionSet instructionSet)
+{
+	switch (instructionSet) {
+		case InstructionSet::Portable:
+			return true;
+#ifdef GENE_KERNELS_X86
+		case InstructionSet::Avx2: {
+				// XMM and YMM states saved by the OS
+				static bool const supported{ osSupportsAvx(0x6) && (extendedFeatures() & (1u << 5)) != 0 };
+				return supported;
+			}
+		case InstructionSet::Avx512: {
+				// opmask and ZMM states saved by the OS in addition
+				static bool const supported{ osSupportsAvx(0xE6) && (extendedFeatures() & (1u << 16)) != 0 };
+				return supported;
+			}
+#endif
+		default:
+			return false;
+	}
+}
+
+GeneKernels::InstructionSet GeneKernels::active()
+{
+	return activeInstructionSet().load(std::memory_order_relaxed);
+}
+
+bool GeneKernels::setActive(InstructionSet instructionSet)
+{
+	if (!isSupported(instructionSet)) {
+		return false;
+	}
+	activeInstructionSet().store(instructionSet, std::memory_order_relaxed);
+	return true;
+}
+
+char const * GeneKernels::name(InstructionSet instructionSet)
+{
+	switch (instructionSet) {
+		case InstructionSet::Avx512:
+			return "AVX-512";
+		case InstructionSet::Avx2:
+			return "AVX2";
+		case InstructionSet::Portable:
+		default:
+			return "portable";
+	}
+}
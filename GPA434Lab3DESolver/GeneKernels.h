@@ -0,0 +1,46 @@
+#pragma once
+#ifndef GENE_KERNELS_H
+#define GENE_KERNELS_H
+
+
+#include <cstddef>
+#include <cstdint>
+
+
+//! \brief Noyaux vectoriels opérant sur des rangées de gènes contiguës.
+//!
+//! \details Deux opérations sont offertes :
+//!  - la mutation différentielle \f$v = b + F (x_1 - x_2)\f$, à laquelle 
+//!    se réduisent DE/rand/1 et DE/best/1;
+//!  - le mélange selon un masque de bits, utilisé par le croisement 
+//!    binomial : chaque gène de l'essai provient du mutant si son bit est à 
+//!    1, de la cible sinon.
+//! 
+//! Trois implémentations sont disponibles : AVX-512, AVX2 et une version 
+//! portable. La meilleure implémentation supportée par le processeur est 
+//! choisie à la première utilisation.
+//! 
+//! Les noyaux n'utilisent volontairement pas d'instruction FMA : la 
+//! multiplication et l'addition sont arrondies séparément, comme dans la 
+//! version portable. Les trois implémentations donnent donc des résultats 
+//! identiques au bit près et une simulation reproductible le reste, peu 
+//! importe le processeur. Ces noyaux sont de toute façon limités par la 
+//! bande passante mémoire.
+class GeneKernels
+{
+public:
+	enum class InstructionSet { Portable, Avx2, Avx512 };
+
+	//! \brief Calcule `mutant[j] = base[j] + f * (x1[j] - x2[j])` pour `count` gènes. Les rangées peuvent ne pas être alignées.
+	static void differential(double * mutant, double const * base, double const * x1, double const * x2, double f, size_t count);
+	//! \brief Calcule `trial[j] = bit j de mask ? mutant[j] : target[j]` pour `count` gènes. Le bit j est `(mask[j / 64] >> (j % 64)) & 1`.
+	static void blend(double * trial, double const * target, double const * mutant, uint64_t const * mask, size_t count);
+
+	static bool isSupported(InstructionSet instructionSet);			//!< Indique si le processeur supporte le jeu d'instructions.
+	static InstructionSet active();									//!< Retourne le jeu d'instructions utilisé.
+	static bool setActive(InstructionSet instructionSet);			//!< Force un jeu d'instructions (bancs d'essai). Retourne faux, sans rien changer, s'il n'est pas supporté.
+	static char const * name(InstructionSet instructionSet);		//!< Retourne le nom du jeu d'instructions.
+};
+
+
+#endif // GENE_KERNELS_H
@@ -0,0 +1,69 @@
+#include "GenerationTiming.h"
+
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <ctime>
+#endif
+
+
+GenerationTiming& GenerationTiming::operator+=(GenerationTiming const & other)
+{
+	generationCount += other.generationCount;
+	evaluationCount += other.evaluationCount;
+	wallTime += other.wallTime;
+	cpuTime += other.cpuTime;
+	return *this;
+}
+
+void GenerationTiming::clear()
+{
+	*this = GenerationTiming{};
+}
+
+
+
+GenerationStopwatch::GenerationStopwatch()
+{
+	restart();
+}
+
+void GenerationStopwatch::restart()
+{
+	mCpuStart = threadCpuTime();
+	mWallStart = std::chrono::steady_clock::now();
+}
+
+GenerationTiming GenerationStopwatch::elapsed(size_t evaluationCount, size_t generationCount) const
+{
+	GenerationTiming timing;
+	timing.wallTime = std::chrono::duration_cast<GenerationTiming::Duration>(std::chrono::steady_clock::now() - mWallStart);
+	timing.cpuTime = threadCpuTime() - mCpuStart;
+	timing.generationCount = generationCount;
+	timing.evaluationCount = evaluationCount;
+	return timing;
+}
+
+GenerationTiming::Duration GenerationStopwatch::threadCpuTime()
+{
+#ifdef _WIN32
+	// std::clock mesure le temps réel sous MSVC, d'où l'appel à GetThreadTimes
+	FILETIME creation, exit, kernel, user;
+	if (!GetThreadTimes(GetCurrentThread(), &creation, &exit, &kernel, &user)) {
+		return {};
+	}
+	auto toTicks{ [](FILETIME const & time) { return (static_cast<unsigned long long>(time.dwHighDateTime) << 32) | time.dwLowDateTime; } };
+	// unités de 100 ns
+	return GenerationTiming::Duration((toTicks(kernel) + toTicks(user)) * 100);
+#else
+	timespec time{};
+	if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time) != 0) {
+		return {};
+	}
+	return std::chrono::seconds(time.tv_sec) + std::chrono::nanoseconds(time.tv_nsec);
+#endif
+}
@@ -0,0 +1,57 @@
+#pragma once
+#ifndef GENERATION_TIMING_H
+#define GENERATION_TIMING_H
+
+
+#include <chrono>
+#include <cstddef>
+
+
+//! \brief Mesures de temps d'une ou de plusieurs générations.
+//!
+//! \details La structure sert autant pour une seule génération que pour le 
+//! cumul de toute une simulation (voir `operator+=`). Le temps processeur 
+//! est celui du fil d'exécution ayant effectué la génération.
+//! 
+//! Le découpage par phase (mutation, croisement, sélection, etc.) n'est pas 
+//! disponible : ces phases sont enchaînées à l'intérieur de 
+//! `de::DifferentialEvolution::processToNextGeneration`.
+struct GenerationTiming
+{
+	using Duration = std::chrono::nanoseconds;
+
+	size_t generationCount{};											//!< Nombre de générations mesurées.
+	size_t evaluationCount{};											//!< Nombre d'évaluations de la fonction objectif.
+	Duration wallTime{};												//!< Temps réel écoulé.
+	Duration cpuTime{};													//!< Temps processeur du fil d'exécution.
+
+	GenerationTiming& operator+=(GenerationTiming const & other);		//!< Ajoute les mesures d'une autre génération.
+	void clear();														//!< Remet toutes les mesures à zéro.
+};
+
+
+//! \brief Chronomètre d'une génération.
+//!
+//! \details Utilisation typique :
+//! \code
+//!		GenerationStopwatch stopwatch;
+//!		de.processToNextGeneration();
+//!		GenerationTiming timing{ stopwatch.elapsed(populationSize) };
+//! \endcode
+class GenerationStopwatch
+{
+public:
+	GenerationStopwatch();												//!< Constructeur démarrant le chronomètre.
+
+	void restart();														//!< Redémarre le chronomètre.
+	GenerationTiming elapsed(size_t evaluationCount, size_t generationCount = 1) const; //!< Retourne les mesures depuis le démarrage, attribuées à `generationCount` générations.
+
+	static GenerationTiming::Duration threadCpuTime();					//!< Retourne le temps processeur consommé par le fil d'exécution courant.
+
+private:
+	std::chrono::steady_clock::time_point mWallStart;
+	GenerationTiming::Duration mCpuStart;
+};
+
+
+#endif // GENERATION_TIMING_H
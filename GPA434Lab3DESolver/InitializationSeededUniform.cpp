@@ -0,0 +1,46 @@
+#include "InitializationSeededUniform.h"
+
+
+#include <algorithm>
+#include <vector>
+#include <SolutionStrategy.h>
+#include <Population.h>
+#include "SolutionData.h"
+
+
+static const std::string isu_title("Uniforme reproductible");
+static const std::string isu_summary("Initialisation uniforme dans le domaine à partir d'un germe.");
+static const std::string isu_description("Chaque valeur est tirée uniformément entre les bornes du domaine par un générateur à compteur (Philox4x32-10). Pour un même germe, la population initiale est toujours la même, peu importe le nombre de fils d'exécution utilisés.");
+
+
+InitializationSeededUniform::InitializationSeededUniform(uint64_t seed)
+	: InitializationStrategy(isu_title, isu_summary, isu_description)
+	, SeededStrategy(seed)
+{
+}
+
+void InitializationSeededUniform::process(de::SolutionStrategy const & solutionStrategy, de::Population & actualPopulation)
+{
+	de::SolutionDomain const & domain{ solutionStrategy.domain() };
+
+	// les bornes sont lues une seule fois plutôt qu'à chaque gène
+	std::vector<double> lower(domain.size());
+	std::vector<double> width(domain.size());
+	for (size_t j{}; j < domain.size(); ++j) {
+		lower[j] = domain[j].lower();
+		width[j] = domain[j].upper() - domain[j].lower();
+	}
+
+	for (size_t i{}; i < actualPopulation.size(); ++i) {
+		de::Solution & solution{ actualPopulation[i] };
+		size_t const dimension{ std::min(solution.size(), domain.size()) };
+		if (dimension == 0) {
+			continue;
+		}
+
+		double * genes{ solutionData(solution) };
+		for (size_t j{}; j < dimension; ++j) {
+			genes[j] = lower[j] + width[j] * random().uniform(sGeneration, sStream, static_cast<uint32_t>(i), static_cast<uint32_t>(j));
+		}
+	}
+}
@@ -0,0 +1,42 @@
+#pragma once
+#ifndef INITIALIZATION_SEEDED_UNIFORM_H
+#define INITIALIZATION_SEEDED_UNIFORM_H
+
+
+#include <InitializationStrategy.h>
+#include "SeededStrategy.h"
+
+
+//! \brief Stratégie d'initialisation uniforme dans le domaine, reproductible.
+//!
+//! \details Chaque gène \f$x_{i,j}\f$ est tiré uniformément dans l'intervalle 
+//! \f$[l_j, u_j[\f$ du domaine de la solution. Contrairement à 
+//! `de::InitializationDomainUniform`, qui passe par `Interval::generate` et 
+//! son générateur statique, les tirages proviennent du générateur à 
+//! compteur de SeededStrategy avec la clé (germe, initialisation, individu, 
+//! gène). Contrairement aux autres stratégies reproductibles, le compteur 
+//! de génération n'intervient pas : deux initialisations avec le même germe 
+//! sont identiques, même successives (par exemple après une 
+//! réinitialisation), peu importe l'ordre ou le fil d'exécution dans 
+//! lequel elles sont faites.
+class InitializationSeededUniform : public de::InitializationStrategy, public SeededStrategy
+{
+public:
+	InitializationSeededUniform(uint64_t seed = 0);											//!< Constructeur avec initialisation du germe.
+	InitializationSeededUniform(InitializationSeededUniform const &) = default;				//!< Constructeur de copie.
+	InitializationSeededUniform(InitializationSeededUniform &&) = default;					//!< Constructeur de déplacement.
+	InitializationSeededUniform& operator=(InitializationSeededUniform const &) = default;	//!< Opérateur d'assignation de copie.
+	InitializationSeededUniform& operator=(InitializationSeededUniform &&) = default;		//!< Opérateur d'assignation de déplacement.
+	~InitializationSeededUniform() override = default;										//!< Destructeur.
+
+	void process(de::SolutionStrategy const & solutionStrategy, de::Population & actualPopulation) override; //!< Initialise uniformément chaque solution dans le domaine de solutionStrategy.
+
+	DEFINE_OVERRIDE_CLONE_METHOD(InitializationSeededUniform)								//!< Macro définissant automatiquement la substitution de la méthode de clonage.
+
+private:
+	static constexpr uint32_t sStream{ 0x494E4954u };
+	static constexpr uint32_t sGeneration{};	// fixed: every initialization with the same seed is the same
+};
+
+
+#endif // INITIALIZATION_SEEDED_UNIFORM_H
@@ -0,0 +1,53 @@
+#include "MutationSeededBest1.h"
+
+
+#include <algorithm>
+#include <array>
+#include <Population.h>
+#include "DonorSampler.h"
+#include "SolutionData.h"
+#include "GeneKernels.h"
+
+
+static const std::string msb1_title("Best1 reproductible");
+static const std::string msb1_summary("Mutation DE/best/1 à partir d'un germe.");
+static const std::string msb1_description("Le mutant est formé de la meilleure solution et de deux solutions distinctes tirées au hasard : v = xbest + F (x1 - x2). Les donneurs sont tirés en temps constant et les tirages proviennent d'un générateur à compteur, la mutation est donc reproductible pour un même germe.");
+
+
+MutationSeededBest1::MutationSeededBest1(double f, uint64_t seed)
+	: MutationStrategy(msb1_title, msb1_summary, msb1_description, f)
+	, SeededStrategy(seed)
+{
+}
+
+void MutationSeededBest1::process(de::Population const & actualPopulation, de::Population & mutantPopulation)
+{
+	double const f{ mutationFactor() };
+	size_t const populationSize{ std::min(actualPopulation.size(), mutantPopulation.size()) };
+	std::array<size_t, 2> donors{};
+
+	if (populationSize == 0 || actualPopulation[sBestIndex].size() == 0) {
+		// the counter advances on every call, as in MutationSeededRand1, to stay in step with the generation
+		nextGeneration();
+		return;
+	}
+
+	double const * best{ solutionData(actualPopulation[sBestIndex]) };
+
+	for (size_t i{}; i < populationSize; ++i) {
+		size_t const excluded[]{ i, sBestIndex };
+		DonorSampler::sample(actualPopulation.size(), excluded, donors, random(), generation(), sStream, static_cast<uint32_t>(i));
+
+		de::Solution & mutant{ mutantPopulation[i] };
+		size_t const dimension{ mutant.size() };
+		if (dimension == 0) {
+			continue;
+		}
+
+		double const * x1{ solutionData(actualPopulation[donors[0]]) };
+		double const * x2{ solutionData(actualPopulation[donors[1]]) };
+		GeneKernels::differential(solutionData(mutant), best, x1, x2, f, dimension);
+	}
+
+	nextGeneration();
+}
@@ -0,0 +1,41 @@
+#pragma once
+#ifndef MUTATION_SEEDED_BEST_1_H
+#define MUTATION_SEEDED_BEST_1_H
+
+
+#include <MutationStrategy.h>
+#include "SeededStrategy.h"
+
+
+//! \brief Stratégie de mutation DE/best/1 reproductible.
+//!
+//! \details Pour chaque individu cible \f$i\f$, deux donneurs distincts 
+//! \f$r_1, r_2\f$, différents de la cible et de la meilleure solution, sont 
+//! tirés et le mutant est : \f$v_i = x_{best} + F (x_{r_1} - x_{r_2})\f$.
+//!
+//! La population reçue est triée par l'engin avant la mutation, la 
+//! meilleure solution est donc à la position 0 (comme l'utilise aussi la 
+//! visualisation de l'application).
+//!
+//! Voir MutationSeededRand1 pour les différences avec `de::MutationBest1`.
+class MutationSeededBest1 : public de::MutationStrategy, public SeededStrategy
+{
+public:
+	MutationSeededBest1(double f = 0.5, uint64_t seed = 0);						//!< Constructeur avec initialisation du facteur de mutation et du germe.
+	MutationSeededBest1(MutationSeededBest1 const &) = default;					//!< Constructeur de copie.
+	MutationSeededBest1(MutationSeededBest1 &&) = default;						//!< Constructeur de déplacement.
+	MutationSeededBest1& operator=(MutationSeededBest1 const &) = default;		//!< Opérateur d'assignation de copie.
+	MutationSeededBest1& operator=(MutationSeededBest1 &&) = default;			//!< Opérateur d'assignation de déplacement.
+	~MutationSeededBest1() override = default;									//!< Destructeur.
+
+	void process(de::Population const & actualPopulation, de::Population & mutantPopulation) override; //!< Applique la stratégie de mutation sur la population.
+
+	DEFINE_OVERRIDE_CLONE_METHOD(MutationSeededBest1)							//!< Macro définissant automatiquement la substitution de la méthode de clonage.
+
+private:
+	static constexpr uint32_t sStream{ 0x42455354u };
+	static constexpr size_t sBestIndex{ 0 };
+};
+
+
+#endif // MUTATION_SEEDED_BEST_1_H
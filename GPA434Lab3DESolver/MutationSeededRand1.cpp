@@ -0,0 +1,46 @@
+#include "MutationSeededRand1.h"
+
+
+#include <algorithm>
+#include <array>
+#include <Population.h>
+#include "DonorSampler.h"
+#include "SolutionData.h"
+#include "GeneKernels.h"
+
+
+static const std::string msr1_title("Rand1 reproductible");
+static const std::string msr1_summary("Mutation DE/rand/1 à partir d'un germe.");
+static const std::string msr1_description("Le mutant est formé de trois solutions distinctes tirées au hasard : v = x1 + F (x2 - x3). Les donneurs sont tirés en temps constant et les tirages proviennent d'un générateur à compteur, la mutation est donc reproductible pour un même germe.");
+
+
+MutationSeededRand1::MutationSeededRand1(double f, uint64_t seed)
+	: MutationStrategy(msr1_title, msr1_summary, msr1_description, f)
+	, SeededStrategy(seed)
+{
+}
+
+void MutationSeededRand1::process(de::Population const & actualPopulation, de::Population & mutantPopulation)
+{
+	double const f{ mutationFactor() };
+	size_t const populationSize{ std::min(actualPopulation.size(), mutantPopulation.size()) };
+	std::array<size_t, 3> donors{};
+
+	for (size_t i{}; i < populationSize; ++i) {
+		size_t const excluded[]{ i };
+		DonorSampler::sample(actualPopulation.size(), excluded, donors, random(), generation(), sStream, static_cast<uint32_t>(i));
+
+		de::Solution & mutant{ mutantPopulation[i] };
+		size_t const dimension{ mutant.size() };
+		if (dimension == 0) {
+			continue;
+		}
+
+		double const * x1{ solutionData(actualPopulation[donors[0]]) };
+		double const * x2{ solutionData(actualPopulation[donors[1]]) };
+		double const * x3{ solutionData(actualPopulation[donors[2]]) };
+		GeneKernels::differential(solutionData(mutant), x1, x2, x3, f, dimension);
+	}
+
+	nextGeneration();
+}
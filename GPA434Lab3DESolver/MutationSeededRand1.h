@@ -0,0 +1,40 @@
+#pragma once
+#ifndef MUTATION_SEEDED_RAND_1_H
+#define MUTATION_SEEDED_RAND_1_H
+
+
+#include <MutationStrategy.h>
+#include "SeededStrategy.h"
+
+
+//! \brief Stratégie de mutation DE/rand/1 reproductible.
+//!
+//! \details Pour chaque individu cible \f$i\f$, trois donneurs distincts 
+//! \f$r_1, r_2, r_3 \neq i\f$ sont tirés et le mutant est :
+//! \f$v_i = x_{r_1} + F (x_{r_2} - x_{r_3})\f$.
+//!
+//! C'est la même règle que `de::MutationRand1`, mais :
+//!  - les donneurs sont tirés par DonorSampler en \f$O(1)\f$ par individu 
+//!    plutôt que par un échantillon de toute la population;
+//!  - les tirages proviennent du générateur à compteur de SeededStrategy, 
+//!    la mutation est donc reproductible et sans état partagé.
+class MutationSeededRand1 : public de::MutationStrategy, public SeededStrategy
+{
+public:
+	MutationSeededRand1(double f = 0.5, uint64_t seed = 0);						//!< Constructeur avec initialisation du facteur de mutation et du germe.
+	MutationSeededRand1(MutationSeededRand1 const &) = default;					//!< Constructeur de copie.
+	MutationSeededRand1(MutationSeededRand1 &&) = default;						//!< Constructeur de déplacement.
+	MutationSeededRand1& operator=(MutationSeededRand1 const &) = default;		//!< Opérateur d'assignation de copie.
+	MutationSeededRand1& operator=(MutationSeededRand1 &&) = default;			//!< Opérateur d'assignation de déplacement.
+	~MutationSeededRand1() override = default;									//!< Destructeur.
+
+	void process(de::Population const & actualPopulation, de::Population & mutantPopulation) override; //!< Applique la stratégie de mutation sur la population.
+
+	DEFINE_OVERRIDE_CLONE_METHOD(MutationSeededRand1)							//!< Macro définissant automatiquement la substitution de la méthode de clonage.
+
+private:
+	static constexpr uint32_t sStream{ 0x52414E44u };
+};
+
+
+#endif // MUTATION_SEEDED_RAND_1_H
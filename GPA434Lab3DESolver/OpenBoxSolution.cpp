@@ -0,0 +1,57 @@
+#include "OpenBoxSolution.h"
+
+
+#include <algorithm>
+#include <Solution.h>
+#include <OptimizationMaximization.h>
+#include <FitnessIdentity.h>
+#include <format>
+
+
+static const std::string obp_title("Boîte ouverte");
+static const std::string obp_summary("<p>Le problème de la boîte ouverte consiste à déterminer la taille de la coupe au quatre coins d'une surface rectangulaire permettant d'optimizer le volume de la boîte issue du pliage de cette feuille.</p>");
+static const std::string obp_description(R".(<p>Ce problème se résoud dans un espace à une dimension, représantant la taille de la coupe 'cut' au quatre coins de la surface rectangulaire.</p>
+
+<p>Le domaine de cette dimension correspond aux tailles possible de la coupe. Elle doit être comprise entre 0 et la moitié de la plus petite dimension de la surface rectangulaire. Théoriquement, les bornes devraient être excluses c = ]0, min(width, height) / 2[.</p>
+
+<p>La fonction objective est le volume de la boîte issue de la coupe.<br/>
+f(cut) = (width - 2 * cut) * (height - 2 * cut) * cut</p>).");
+
+
+OpenBoxSolution::OpenBoxSolution(double width, double height)
+	: SolutionStrategy(obp_title, obp_summary, obp_description)
+	, mWidth{ width }
+	, mHeight{ height }
+{
+	// domain definition
+	mSolutionDomain.resize(1);
+	mSolutionDomain[0].set(0.0, std::min(height, width) / 2.0);
+	
+	// strategies definition
+	setOptimizationStrategy(new de::OptimizationMaximization);
+	setFitnessStrategy(new de::FitnessIdentity);
+}
+
+std::string OpenBoxSolution::toString(de::Solution const & solution) const
+{
+	// return the solution as a formatted string
+	return std::format(R"...(
+Taille de la feuille : {} x {}
+Taille de la coupe   : {:0.6f} x {:0.6f}
+Volume de la boite   : {:0.6f})...", mWidth, mHeight, solution[0], solution[0], solution.fitness());
+}
+
+double OpenBoxSolution::process(de::Solution const & solution)
+{
+	// assign a local variable for the cut size - only for readability
+	double cut{ solution[0] };
+
+	// validate if the solution is inside the domain
+	if (!mSolutionDomain[0].validate(cut)) {
+		return 0.0;
+	}
+
+	// process the volume of the box
+	return cut * (mWidth - 2.0 * cut) * (mHeight - 2.0 * cut);
+}
+
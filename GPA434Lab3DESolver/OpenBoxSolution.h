@@ -0,0 +1,34 @@
+#pragma once
+#ifndef OPEN_BOX_SOLUTION_H
+#define OPEN_BOX_SOLUTION_H
+
+
+#include <SolutionStrategy.h>
+
+
+//! \brief Classe représentant une stratégie de solution pour la 
+//! résolution du problème de la boîte ouverte.
+class OpenBoxSolution : public de::SolutionStrategy
+{
+public:
+	OpenBoxSolution(double width = 1.0, double height = 1.0);
+	OpenBoxSolution(OpenBoxSolution const &) = default;
+	OpenBoxSolution(OpenBoxSolution &&) = default;
+	OpenBoxSolution& operator=(OpenBoxSolution const &) = default;
+	OpenBoxSolution& operator=(OpenBoxSolution &&) = default;
+	~OpenBoxSolution() override = default;
+
+	std::string toString(de::Solution const & ag) const override;
+
+	DEFINE_OVERRIDE_CLONE_METHOD(OpenBoxSolution)	     //!< Macro définissant automatiquement la substitution de la méthode de clonage.
+
+protected:
+	double process(de::Solution const & ag) override;
+
+private:
+	double mWidth;
+	double mHeight;
+};
+
+
+#endif // OPEN_BOX_SOLUTION_H
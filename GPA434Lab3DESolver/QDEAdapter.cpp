@@ -1,29 +1,58 @@
 #include "QDEAdapter.h"
 
 
+#include <MutationStrategy.h>
+#include <CrossoverStrategy.h>
+#include "SeededStrategy.h"
+
+
+const int QDEAdapter::mDisplayInterval{ 33 };
+
+
 QDEAdapter::QDEAdapter(QObject *parent)
 	: QObject(parent)
+	, mSnapshot{ std::make_shared<EvolutionSnapshot const>() }
+	, mSlots{ mSnapshot, mSnapshot, mSnapshot }
 {
+	mDisplayTimer.setInterval(mDisplayInterval);
+	connect(&mDisplayTimer, &QTimer::timeout, this, &QDEAdapter::refresh);
 }
 
 bool QDEAdapter::isReady()
 {
-	return mDE.isReady();
+	// the engine was ready when the evolution started and cannot be read meanwhile
+	return isEvolving() || mDE.isReady();
+}
+
+bool QDEAdapter::isEvolving() const
+{
+	return mWorker.joinable();
 }
 
 size_t QDEAdapter::currentGeneration() const
 {
-	return mDE.currentGeneration();
+	return mSnapshot->generation;
 }
 
 bool QDEAdapter::isStoppingCriteriaReached() const
 {
-	return mDE.isStoppingCriteriaReached();
+	return mSnapshot->stoppingCriteriaReached;
 }
 
 de::DifferentialEvolution::SetupState QDEAdapter::setup(de::SolutionStrategy * solution)
 {
-	return mDE.setup(solution);
+	// like the step timer, a running evolution goes on with the new problem
+	bool const wasEvolving{ isEvolving() };
+	stopEvolution();
+	clearTiming();
+	clearFitness();
+	de::DifferentialEvolution::SetupState const state{ mDE.setup(solution) };
+	publish();
+	adoptSnapshot();
+	if (wasEvolving) {
+		startEvolution();
+	}
+	return state;
 }
 
 de::SolutionStrategy const & QDEAdapter::solution()
@@ -33,7 +62,7 @@ de::SolutionStrategy const & QDEAdapter::solution()
 
 QString QDEAdapter::bestSolutionInfo() const
 {
-	return QString::fromStdString(mDE.bestSolutionInfo());
+	return QString::fromStdString(mSnapshot->bestSolutionInfo);
 }
 
 de::History const & QDEAdapter::statisticsHistory() const
@@ -41,36 +70,239 @@ de::History const & QDEAdapter::statisticsHistory() const
 	return mDE.statisticsHistory();
 }
 
-de::Population QDEAdapter::actualPopulation() const
+FitnessHistory const & QDEAdapter::fitnessHistory() const
+{
+	return mFitnessHistory;
+}
+
+std::shared_ptr<EvolutionSnapshot const> QDEAdapter::snapshot() const
+{
+	return mSnapshot;
+}
+
+std::shared_ptr<de::Population const> QDEAdapter::actualPopulation() const
+{
+	// aliasing constructor: shares the snapshot ownership, points to its population
+	return std::shared_ptr<de::Population const>(mSnapshot, &mSnapshot->population);
+}
+
+bool QDEAdapter::isTimingEnabled() const
+{
+	return mTimingEnabled;
+}
+
+void QDEAdapter::setTimingEnabled(bool enabled)
+{
+	mTimingEnabled = enabled;
+}
+
+GenerationTiming const & QDEAdapter::lastGenerationTiming() const
 {
-	return mDE.actualPopulation();
+	return mSnapshot->lastGenerationTiming;
+}
+
+GenerationTiming const & QDEAdapter::totalTiming() const
+{
+	return mSnapshot->totalTiming;
+}
+
+void QDEAdapter::clearTiming()
+{
+	mLastGenerationTiming.clear();
+	mTotalTiming.clear();
+}
+
+void QDEAdapter::rewindSeededStrategies()
+{
+	// the seeded strategies replay the same run only if their counters start over
+	de::EngineParameters parameters{ mDE.engineParameters() };
+	std::unique_ptr<de::MutationStrategy> mutation{ parameters.mutationStrategy() };
+	std::unique_ptr<de::CrossoverStrategy> crossover{ parameters.crossoverStrategy() };
+	bool rewound{};
+	if (SeededStrategy * seeded{ dynamic_cast<SeededStrategy *>(mutation.get()) }) {
+		seeded->setGeneration(0);
+		parameters.setMutationStrategy(mutation.release());
+		rewound = true;
+	}
+	if (SeededStrategy * seeded{ dynamic_cast<SeededStrategy *>(crossover.get()) }) {
+		seeded->setGeneration(0);
+		parameters.setCrossoverStrategy(crossover.release());
+		rewound = true;
+	}
+	if (rewound) {
+		mDE.setEngineParameters(parameters);
+	}
+}
+
+void QDEAdapter::clearFitness()
+{
+	mFitnessHistory.clear();
+	mUndeliveredFitness.clear();
+	mDeliveredGeneration = 0;
 }
 
 void QDEAdapter::setEngineParameters(de::EngineParameters const& parameters)
 {
+	bool const wasEvolving{ isEvolving() };
+	stopEvolution();
 	mDE.setEngineParameters(parameters);
+	publish();
+	adoptSnapshot();
+	if (wasEvolving) {
+		startEvolution();
+	}
+}
+
+void QDEAdapter::processGeneration()
+{
+	if (mTimingEnabled) {
+		GenerationStopwatch stopwatch;
+		mDE.processToNextGeneration();
+		// chaque génération évalue une fois chaque vecteur d'essai
+		mLastGenerationTiming = stopwatch.elapsed(mDE.actualPopulation().size());
+		mTotalTiming += mLastGenerationTiming;
+	} else {
+		mDE.processToNextGeneration();
+	}
+
+	de::Statistics const & statistics{ mDE.statisticsHistory().last() };
+	mUndeliveredFitness.push_back({ mDE.currentGeneration(), statistics.bestSolution().fitness(), statistics.medianSolution().fitness(), statistics.worstSolution().fitness() });
+}
+
+void QDEAdapter::publish()
+{
+	std::shared_ptr<EvolutionSnapshot> snapshot{ std::make_shared<EvolutionSnapshot>() };
+	snapshot->generation = mDE.currentGeneration();
+	snapshot->stoppingCriteriaReached = mDE.isStoppingCriteriaReached();
+	snapshot->population = mDE.actualPopulation();
+	if (snapshot->generation > 0) {
+		snapshot->bestSolutionInfo = mDE.bestSolutionInfo();
+	}
+	snapshot->lastGenerationTiming = mLastGenerationTiming;
+	snapshot->totalTiming = mTotalTiming;
+
+	// the generations already added to the history are no longer needed
+	size_t const delivered{ mDeliveredGeneration.load(std::memory_order_acquire) };
+	std::erase_if(mUndeliveredFitness, [delivered](EvolutionSnapshot::FitnessRecord const & record) { return record.generation <= delivered; });
+	snapshot->fitness = mUndeliveredFitness;
+
+	// fill the back slot, then swap it with the middle one, marked as fresh
+	mSlots[mBackSlot] = std::move(snapshot);
+	mBackSlot = mMiddleSlot.exchange(mBackSlot | sFreshSlot, std::memory_order_acq_rel) & sSlotMask;
+}
+
+bool QDEAdapter::adoptSnapshot()
+{
+	bool stepped{};
+	if (mMiddleSlot.load(std::memory_order_relaxed) & sFreshSlot) {
+		// take the fresh middle slot, give back the displayed one
+		mFrontSlot = mMiddleSlot.exchange(mFrontSlot, std::memory_order_acq_rel) & sSlotMask;
+		std::shared_ptr<EvolutionSnapshot const> latest{ mSlots[mFrontSlot] };
+
+		size_t delivered{ mDeliveredGeneration.load(std::memory_order_relaxed) };
+		for (EvolutionSnapshot::FitnessRecord const & record : latest->fitness) {
+			if (record.generation > delivered) {
+				mFitnessHistory.add(record.best, record.median, record.worst);
+				delivered = record.generation;
+			}
+		}
+		mDeliveredGeneration.store(delivered, std::memory_order_release);
+
+		stepped = latest->generation != mSnapshot->generation;
+		mSnapshot = std::move(latest);
+	}
+	// the evolving thread copies the population again only once this one is displayed
+	mSnapshotRequested = true;
+	return stepped;
+}
+
+void QDEAdapter::refresh()
+{
+	if (adoptSnapshot()) {
+		emit oneEvolutionStepped();
+	}
+
+	if (mSnapshot->stoppingCriteriaReached) {
+		if (mWorker.joinable()) {
+			mWorker.join();
+			mDisplayTimer.stop();
+		}
+		emit stoppingCriteriaReached();
+	}
 }
 
 void QDEAdapter::stepEvolution()
 {
-	if (!isReady()) {
+	if (isEvolving() || !isReady()) {
 		return;
 	}
 
 	if (!mDE.isStoppingCriteriaReached()) {
-		mDE.processToNextGeneration();
-		emit oneEvolutionStepped();
+		processGeneration();
+		publish();
 	}
+	refresh();
+}
 
-	if (mDE.isStoppingCriteriaReached()) {
-		emit stoppingCriteriaReached();
+void QDEAdapter::stepEvolutionWithin(int milliseconds)
+{
+	if (isEvolving() || !isReady()) {
+		return;
+	}
+
+	std::chrono::steady_clock::time_point const deadline{ std::chrono::steady_clock::now() + std::chrono::milliseconds(milliseconds) };
+	if (!mDE.isStoppingCriteriaReached()) {
+		// the panels are updated once for the whole burst
+		do {
+			processGeneration();
+		} while (!mDE.isStoppingCriteriaReached() && std::chrono::steady_clock::now() < deadline);
+		publish();
+	}
+	refresh();
+}
+
+void QDEAdapter::evolve(std::stop_token stopToken)
+{
+	while (!stopToken.stop_requested() && !mDE.isStoppingCriteriaReached()) {
+		processGeneration();
+		if (mSnapshotRequested.exchange(false)) {
+			publish();
+		}
 	}
+	publish();
+}
+
+void QDEAdapter::startEvolution()
+{
+	if (isEvolving() || !mDE.isReady() || mDE.isStoppingCriteriaReached()) {
+		return;
+	}
+
+	mSnapshotRequested = false;
+	mWorker = std::jthread([this](std::stop_token stopToken) { evolve(stopToken); });
+	mDisplayTimer.start();
+}
+
+void QDEAdapter::stopEvolution()
+{
+	if (!mWorker.joinable()) {
+		return;
+	}
+
+	mWorker.request_stop();
+	mWorker.join();
+	mDisplayTimer.stop();
+	refresh();
 }
 
 void QDEAdapter::reset()
 {
+	stopEvolution();
+	rewindSeededStrategies();
 	mDE.reset();
+	clearTiming();
+	clearFitness();
+	publish();
+	adoptSnapshot();
 	emit wasReset();
 }
-
-
@@ -1,9 +1,19 @@
 #pragma once
 
 
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
 #include <QObject>
+#include <QTimer>
 #include <DifferentialEvolution.h>
 #include <EngineParameters.h>
+#include "GenerationTiming.h"
+#include "FitnessHistory.h"
+#include "EvolutionSnapshot.h"
 
 
 //! 
@@ -35,6 +45,27 @@
 //! `QDEAdapter` permet le meilleur des deux mondes en acceptant le compromis 
 //! d'un faible coût de performance.
 //! 
+//! L'évolution peut s'effectuer pas à pas (stepEvolution, sur le fil de 
+//! l'interface), par rafales limitées par un budget de temps 
+//! (stepEvolutionWithin, aussi sur le fil de l'interface) ou en continu sur un fil d'exécution dédié 
+//! (startEvolution). Dans ce second cas, l'engin progresse à pleine vitesse 
+//! sans jamais bloquer l'interface. Les accesseurs ne lisent donc jamais 
+//! l'engin directement : ils lisent le dernier EvolutionSnapshot publié. 
+//! Le fil d'évolution ne copie la population que lorsque l'interface a 
+//! consommé l'instantané précédent; une minuterie d'affichage récupère le 
+//! plus récent et émet `oneEvolutionStepped` une seule fois par 
+//! rafraîchissement, peu importe le nombre de générations effectuées. La 
+//! vitesse de l'évolution et celle de l'affichage sont ainsi indépendantes.
+//! 
+//! La remise des instantanés est sans verrou (_lock-free_) : un tampon 
+//! triple de trois emplacements, dont le fil d'évolution et l'interface 
+//! s'échangent les indices par une seule opération atomique. Les 
+//! « fitness » de chaque génération voyagent dans les instantanés; 
+//! l'interface confirme la dernière génération reçue par un compteur 
+//! atomique, ce qui permet au fil d'évolution d'oublier les générations 
+//! déjà livrées. Seul le décompte des références des `std::shared_ptr` 
+//! demeure, lui aussi atomique.
+//! 
 class QDEAdapter : public QObject
 {
 	Q_OBJECT
@@ -52,21 +83,32 @@ public:
 	~QDEAdapter() override = default;					//!< Destructeur par défaut.
 
 	bool isReady();										//!< Vérifie si l'adaptateur est prêt, c'est-à-dire, si le moteur d'évolution différentielle est prêt.
+	bool isEvolving() const;							//!< Indique si l'évolution s'exécute sur le fil d'exécution dédié.
 	size_t currentGeneration() const;					//!< Renvoie le numéro de la génération actuelle.
 	bool isStoppingCriteriaReached() const;				//!< Vérifie si le critère d'arrêt a été atteint.
 
 	de::SolutionStrategy const& solution();				//!< Renvoie la solution actuelle. Cette fonction lancera une exception si aucune solution n'est définie.
 
 	QString bestSolutionInfo() const;					//!< Renvoie une représentation textuelle de la meilleure solution obtenue.
-	de::History const& statisticsHistory() const;		//!< Renvoie l'historique des statistiques en lecture seule.
+	de::History const& statisticsHistory() const;		//!< Renvoie l'historique des statistiques en lecture seule. À n'utiliser que si l'évolution ne s'exécute pas sur le fil dédié (isEvolving).
+	FitnessHistory const& fitnessHistory() const;		//!< Renvoie l'historique des « fitness » à mémoire bornée (meilleure, médiane et pire de chaque génération).
+
+	std::shared_ptr<EvolutionSnapshot const> snapshot() const; //!< Renvoie l'instantané affiché. L'objet est immuable et partagé : aucune copie n'est faite.
+	std::shared_ptr<de::Population const> actualPopulation() const; //!< Renvoie la population actuelle de l'instantané affiché, en lecture seule et sans copie. Elle demeure valide tant que le pointeur est conservé.
 
-	de::Population actualPopulation() const;			//!< Renvoie une copie de la population actuelle.
+	bool isTimingEnabled() const;						//!< Indique si le temps de chaque génération est mesuré.
+	void setTimingEnabled(bool enabled);				//!< Active ou désactive la mesure du temps. Désactivée, aucune horloge n'est lue.
+	GenerationTiming const& lastGenerationTiming() const; //!< Renvoie les mesures de la dernière génération (vides si la mesure est désactivée).
+	GenerationTiming const& totalTiming() const;		//!< Renvoie le cumul des mesures depuis la dernière réinitialisation.
 
 public slots:
 	de::DifferentialEvolution::SetupState setup(de::SolutionStrategy* solution); //!< Configure l'adaptateur avec des paramètres de moteur et une stratégie de solution.
 	void setEngineParameters(de::EngineParameters const& parameters); //!< Définit les paramètres du moteur d'évolution différentielle.
 	void stepEvolution();								//!< Effectue une étape de l'évolution.
+	void stepEvolutionWithin(int milliseconds);			//!< Effectue autant de générations que le budget de temps le permet (au moins une), puis rafraîchit l'affichage une seule fois.
 	void reset();										//!< Réinitialise la simulation à son état initial (tel que défini par EngineParameters).
+	void startEvolution();								//!< Démarre l'évolution continue sur le fil d'exécution dédié.
+	void stopEvolution();								//!< Arrête l'évolution continue et attend la fin de la génération en cours.
 
 signals:
 	void oneEvolutionStepped();							//!< Signal émis après une étape de l'évolution.
@@ -74,7 +116,35 @@ signals:
 	void stoppingCriteriaReached();						//!< Signal émis lorsque le critère d'arrêt est atteint.
 
 private:
+
 	de::DifferentialEvolution mDE;						//!< Instance de l'algorithme d'évolution différentielle.
+	std::atomic<bool> mTimingEnabled{};					//!< Mesure du temps activée.
+	GenerationTiming mLastGenerationTiming;				//!< Mesures de la dernière génération (fil qui fait évoluer l'engin).
+	GenerationTiming mTotalTiming;						//!< Cumul des mesures (fil qui fait évoluer l'engin).
+	FitnessHistory mFitnessHistory;						//!< Historique des « fitness » à mémoire bornée (fil de l'interface).
+
+	std::shared_ptr<EvolutionSnapshot const> mSnapshot;	//!< Instantané affiché (fil de l'interface).
+	std::array<std::shared_ptr<EvolutionSnapshot const>, 3> mSlots; //!< Tampon triple des instantanés publiés.
+	uint8_t mBackSlot{ 2 };								//!< Emplacement où publier le prochain instantané (fil qui fait évoluer l'engin).
+	std::atomic<uint8_t> mMiddleSlot{ 1 };				//!< Emplacement échangé, avec sFreshSlot s'il contient un instantané pas encore adopté.
+	uint8_t mFrontSlot{ 0 };							//!< Emplacement de l'instantané adopté (fil de l'interface).
+	std::atomic<bool> mSnapshotRequested{};				//!< L'interface attend un nouvel instantané.
+	std::vector<EvolutionSnapshot::FitnessRecord> mUndeliveredFitness; //!< « Fitness » des générations non confirmées par l'interface (fil qui fait évoluer l'engin).
+	std::atomic<size_t> mDeliveredGeneration{};			//!< Dernière génération ajoutée à l'historique par l'interface.
+	QTimer mDisplayTimer;								//!< Minuterie de rafraîchissement de l'affichage pendant l'évolution continue.
+	std::jthread mWorker;								//!< Fil d'exécution de l'évolution continue (détruit en premier).
+
+	void clearTiming();
+	void clearFitness();
+	void rewindSeededStrategies();
+	void processGeneration();
+	void publish();
+	bool adoptSnapshot();
+	void refresh();
+	void evolve(std::stop_token stopToken);
 
+	static const int mDisplayInterval;
+	static constexpr uint8_t sSlotMask{ 0x3 };
+	static constexpr uint8_t sFreshSlot{ 0x4 };
 };
 
@@ -4,6 +4,8 @@
 #include <QPushButton>
 #include <QSlider>
 #include <QLabel>
+#include <QCheckBox>
+#include <QSpinBox>
 #include <QVBoxLayout>
 #include <QGridLayout>
 #include <QFrame>
@@ -13,6 +15,9 @@ const qreal QDEControllerPanel::mSlowerTimeout{ 500.0 };
 const size_t QDEControllerPanel::mMinimumSpeedRange{ 1 };
 const size_t QDEControllerPanel::mMaximumSpeedRange{ 10 };
 const size_t QDEControllerPanel::mDefaultSpeedRange{ 7 };
+const int QDEControllerPanel::mMinimumTurboBudget{ 1 };
+const int QDEControllerPanel::mMaximumTurboBudget{ 100 };
+const int QDEControllerPanel::mDefaultTurboBudget{ 12 };
 
 
 QDEControllerPanel::QDEControllerPanel(QDEAdapter const & dEAdapter, QWidget * parent)
@@ -24,6 +29,9 @@ QDEControllerPanel::QDEControllerPanel(QDEAdapter const & dEAdapter, QWidget * p
 	, mSpeedSlider{ new QSlider }
 	, mSpeedLabel{ new QLabel(QString::number(mDefaultSpeedRange)) }
 	, mCurrentGenerationLabel{ new QLabel("0") }
+	, mTurboCheckBox{ new QCheckBox("Turbo (plusieurs générations par pas)") }
+	, mTurboBudgetSpinBox{ new QSpinBox }
+	, mBackgroundCheckBox{ new QCheckBox("Pleine vitesse (fil d'exécution dédié)") }
 {
 	setupGUI();
 	assemblingAndLayouting();
@@ -32,13 +40,17 @@ QDEControllerPanel::QDEControllerPanel(QDEAdapter const & dEAdapter, QWidget * p
 
 void QDEControllerPanel::updateGui()
 {
-	mStepButton->setEnabled(!mSimulationTimer.isActive() && !mDEAdapter.isStoppingCriteriaReached());
-	mResetButton->setEnabled(!mSimulationTimer.isActive());
+	bool const running{ isSimulationRunning() };
+	mStepButton->setEnabled(!running && !mDEAdapter.isStoppingCriteriaReached());
+	mResetButton->setEnabled(!running);
 
 	mStartButton->setEnabled(true);
-	mSpeedSlider->setEnabled(true);
+	mSpeedSlider->setEnabled(!mBackgroundCheckBox->isChecked());
+	mTurboCheckBox->setEnabled(!mBackgroundCheckBox->isChecked());
+	mTurboBudgetSpinBox->setEnabled(!mBackgroundCheckBox->isChecked() && mTurboCheckBox->isChecked());
+	mBackgroundCheckBox->setEnabled(!running);
 
-	mStartButton->setText(mSimulationTimer.isActive() ? "Arrêter" : "Démarrer");
+	mStartButton->setText(running ? "Arrêter" : "Démarrer");
 
 	updateCurrentGeneration();
 }
@@ -53,6 +65,11 @@ qreal QDEControllerPanel::getTimerValue()
 	return (1.0 - static_cast<qreal>(mSpeedSlider->value()) / mSpeedSlider->maximum()) * mSlowerTimeout;
 }
 
+bool QDEControllerPanel::isSimulationRunning() const
+{
+	return mSimulationTimer.isActive() || mDEAdapter.isEvolving();
+}
+
 void QDEControllerPanel::setupGUI()
 {
 	mSpeedSlider->setRange(mMinimumSpeedRange, mMaximumSpeedRange);
@@ -60,6 +77,11 @@ void QDEControllerPanel::setupGUI()
 	mSpeedSlider->setOrientation(Qt::Horizontal);
 	mSpeedSlider->setSizePolicy(QSizePolicy::Expanding, QSizePolicy::Preferred);
 
+	mTurboBudgetSpinBox->setRange(mMinimumTurboBudget, mMaximumTurboBudget);
+	mTurboBudgetSpinBox->setValue(mDefaultTurboBudget);
+	mTurboBudgetSpinBox->setSuffix(" ms");
+	mTurboBudgetSpinBox->setToolTip("Temps consacré à l'évolution à chaque pas, avant de rafraîchir l'affichage.");
+
 	mCurrentGenerationLabel->setAlignment(Qt::AlignVCenter | Qt::AlignLeft);
 }
 
@@ -70,6 +92,12 @@ void QDEControllerPanel::assemblingAndLayouting()
 	sliderLayout->addWidget(mSpeedSlider);
 	sliderLayout->addWidget(mSpeedLabel);
 
+	QHBoxLayout* turboLayout{ new QHBoxLayout };
+	turboLayout->addWidget(mTurboCheckBox);
+	turboLayout->addStretch();
+	turboLayout->addWidget(new QLabel("Budget"));
+	turboLayout->addWidget(mTurboBudgetSpinBox);
+
 	QFrame* separatorFrame{ new QFrame };
 	separatorFrame->setFrameStyle(QFrame::HLine | QFrame::Sunken);
 	separatorFrame->setLineWidth(0);
@@ -89,6 +117,8 @@ void QDEControllerPanel::assemblingAndLayouting()
 	boxLayout->addWidget(separatorFrame);
 	boxLayout->addWidget(mStartButton);
 	boxLayout->addLayout(sliderLayout);
+	boxLayout->addLayout(turboLayout);
+	boxLayout->addWidget(mBackgroundCheckBox);
 	boxLayout->addLayout(currentGenerationLayout);
 	boxLayout->addStretch();
 
@@ -104,7 +134,7 @@ void QDEControllerPanel::establishConnections()
 	connect(mResetButton, &QPushButton::pressed, this, &QDEControllerPanel::resetSimulation);
 	connect(mStartButton, &QPushButton::pressed, this, &QDEControllerPanel::toggleStartStopSimulation);
 
-	connect(&mSimulationTimer, &QTimer::timeout, this, &QDEControllerPanel::evolutionRequired);
+	connect(&mSimulationTimer, &QTimer::timeout, this, &QDEControllerPanel::stepSimulation);
 	connect(&mSimulationTimer, &QTimer::timeout, this, &QDEControllerPanel::updateCurrentGeneration);
 
 	// gui
@@ -113,11 +143,18 @@ void QDEControllerPanel::establishConnections()
 	connect(mStepButton, &QPushButton::pressed, this, &QDEControllerPanel::updateGui);
 	connect(mResetButton, &QPushButton::pressed, this, &QDEControllerPanel::updateGui);
 	connect(mStartButton, &QPushButton::pressed, this, &QDEControllerPanel::updateGui);
+	connect(mTurboCheckBox, &QCheckBox::toggled, this, &QDEControllerPanel::updateGui);
+	connect(mBackgroundCheckBox, &QCheckBox::toggled, this, &QDEControllerPanel::updateGui);
 
 	// adapter connexions
 	connect(this, &QDEControllerPanel::evolutionRequired, &mDEAdapter, &QDEAdapter::stepEvolution);
+	connect(this, &QDEControllerPanel::turboEvolutionRequired, &mDEAdapter, &QDEAdapter::stepEvolutionWithin);
+	connect(this, &QDEControllerPanel::backgroundEvolutionRequired, &mDEAdapter, &QDEAdapter::startEvolution);
+	connect(this, &QDEControllerPanel::backgroundEvolutionStopRequired, &mDEAdapter, &QDEAdapter::stopEvolution);
 	connect(this, &QDEControllerPanel::resetRequired, &mDEAdapter, &QDEAdapter::reset);
 	connect(&mDEAdapter, &QDEAdapter::stoppingCriteriaReached, this, &QDEControllerPanel::stopSimulation);
+	// the background evolution is displayed at the adapter's refresh rate, not at the timer's
+	connect(&mDEAdapter, &QDEAdapter::oneEvolutionStepped, this, &QDEControllerPanel::updateCurrentGeneration);
 }
 
 void QDEControllerPanel::updateCurrentGeneration()
@@ -125,9 +162,23 @@ void QDEControllerPanel::updateCurrentGeneration()
 	mCurrentGenerationLabel->setText(QString::number(mDEAdapter.currentGeneration()));
 }
 
+void QDEControllerPanel::stepSimulation()
+{
+	// in turbo mode, each tick runs as many generations as its budget allows
+	if (mTurboCheckBox->isChecked()) {
+		emit turboEvolutionRequired(mTurboBudgetSpinBox->value());
+	} else {
+		emit evolutionRequired();
+	}
+}
+
 void QDEControllerPanel::startSimulation()
 {
-	mSimulationTimer.start(getTimerValue());
+	if (mBackgroundCheckBox->isChecked()) {
+		emit backgroundEvolutionRequired();
+	} else {
+		mSimulationTimer.start(getTimerValue());
+	}
 	emit evolutionStarted();
 	updateGui();
 }
@@ -141,6 +192,7 @@ void QDEControllerPanel::resetSimulation()
 void QDEControllerPanel::stopSimulation()
 {
 	mSimulationTimer.stop();
+	emit backgroundEvolutionStopRequired();
 	emit evolutionStopped();
 	updateGui();
 }
@@ -151,7 +203,7 @@ void QDEControllerPanel::toggleStartStopSimulation()
 		resetSimulation();
 	}
 
-	if (mSimulationTimer.isActive()) {
+	if (isSimulationRunning()) {
 		stopSimulation();
 	} else {
 		startSimulation();
@@ -7,6 +7,8 @@
 class QPushButton;
 class QSlider;
 class QLabel;
+class QCheckBox;
+class QSpinBox;
 
 
 //! \brief Panneau permettant le contrôle de la simulation.
@@ -24,6 +26,9 @@ public:
 
 signals:
 	void evolutionRequired();
+	void turboEvolutionRequired(int milliseconds);
+	void backgroundEvolutionRequired();
+	void backgroundEvolutionStopRequired();
 	void resetRequired();
 	void evolutionStarted();
 	void evolutionStopped();
@@ -35,6 +40,7 @@ public slots:
 
 private slots:
 	void toggleStartStopSimulation();
+	void stepSimulation();
 	void updateGui();
 	void updateSpeed();
 	void updateCurrentGeneration();
@@ -48,9 +54,13 @@ private:
 	QSlider * mSpeedSlider{};
 	QLabel * mSpeedLabel{};
 	QLabel * mCurrentGenerationLabel{};
+	QCheckBox * mTurboCheckBox{};
+	QSpinBox * mTurboBudgetSpinBox{};
+	QCheckBox * mBackgroundCheckBox{};
 	
 	QTimer mSimulationTimer;
 	qreal getTimerValue();
+	bool isSimulationRunning() const;
 
 	void setupGUI();
 	void assemblingAndLayouting();
@@ -60,4 +70,7 @@ private:
 	static const size_t mMinimumSpeedRange;
 	static const size_t mMaximumSpeedRange;
 	static const size_t mDefaultSpeedRange;
+	static const int mMinimumTurboBudget;
+	static const int mMaximumTurboBudget;
+	static const int mDefaultTurboBudget;
 };
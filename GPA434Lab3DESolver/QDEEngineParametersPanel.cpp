@@ -3,6 +3,8 @@
 #include "QDEEngineParametersPanel.h"
 
 
+#include <memory>
+
 #include <QSpinBox>
 #include <QComboBox>
 #include <QScrollBar>
@@ -22,6 +24,12 @@
 #include <CrossoverExponential.h>
 #include <SelectionBestFitness.h>
 
+#include "InitializationSeededUniform.h"
+#include "MutationSeededRand1.h"
+#include "MutationSeededBest1.h"
+#include "CrossoverSeededBinomial.h"
+#include "CrossoverSeededExponential.h"
+
 
 template <typename T>
 void QDEEngineParametersPanel::addStrategy(T* prototype, StrategyContainer<T>& container, QComboBox* comboBox) {
@@ -58,12 +66,17 @@ QDEEngineParametersPanel::QDEEngineParametersPanel(QDEAdapter const& deAdapter,
 
 	addInitializationStrategy(new de::InitializationBySolution);
 	addInitializationStrategy(new de::InitializationDomainUniform);
+	addInitializationStrategy(new InitializationSeededUniform);
 	addAdaptiveDomainStrategy(new de::AdaptiveDomainNoConstraint);
 	addAdaptiveDomainStrategy(new de::AdaptiveDomainClamped);
 	addMutationStrategy(new de::MutationBest1);
 	addMutationStrategy(new de::MutationRand1);
+	addMutationStrategy(new MutationSeededBest1);
+	addMutationStrategy(new MutationSeededRand1);
 	addCrossoverStrategy(new de::CrossoverBinomial);
 	addCrossoverStrategy(new de::CrossoverExponential);
+	addCrossoverStrategy(new CrossoverSeededBinomial);
+	addCrossoverStrategy(new CrossoverSeededExponential);
 	addSelectionStrategy(new de::SelectionBestFitness);
 
 	connect(this, &QDEEngineParametersPanel::parameterChanged, &mDEAdapter, &QDEAdapter::setEngineParameters);
@@ -103,8 +116,11 @@ void QDEEngineParametersPanel::setParameters(de::EngineParameters const& paramet
 		mPopulationSize->setValue(parameters.populationSize());
 		mGenerationCount->setValue(parameters.maximumGeneration());
 
+		// les accesseurs de EngineParameters retournent un clone dont l'appelant devient propriétaire
 		auto setComboNameIfExist{ [](de::Strategy* strategy, QComboBox* combo) {
-				int index{ combo->findText(QString::fromStdString(strategy->name())) };
+				std::unique_ptr<de::Strategy> owned{ strategy };
+				if (!owned) return;
+				int index{ combo->findText(QString::fromStdString(owned->name())) };
 				if (index >= 0) combo->setCurrentIndex(index);
 			} };
 		
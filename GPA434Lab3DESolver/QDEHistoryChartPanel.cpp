@@ -3,6 +3,13 @@
 
 #include "QDEAdapter.h"
 #include <QValueAxis>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+
+// the chart is rebuilt at display rate, whatever the evolution rate
+const int QDEHistoryChartPanel::sRefreshInterval{ 33 };
 
 
 QDEHistoryChartPanel::QDEHistoryChartPanel(QDEAdapter const& de, QWidget* parent)
@@ -20,24 +27,156 @@ QDEHistoryChartPanel::QDEHistoryChartPanel(QDEAdapter const& de, QWidget* parent
 
 void QDEHistoryChartPanel::updateHistory()
 {
-	mBestData->append(mBestData->count(), mDEAdapter.statisticsHistory().last().bestSolution().fitness());
-	mMedianData->append(mMedianData->count(), mDEAdapter.statisticsHistory().last().medianSolution().fitness());
-	mWorstData->append(mWorstData->count(), mDEAdapter.statisticsHistory().last().worstSolution().fitness());
-
-	double xMin, xMax, yMin, yMax;
-	mDEAdapter.statisticsHistory().getRange(xMin, xMax, yMin, yMax);
-	mChart->axes(Qt::Horizontal)[0]->setRange(xMin, xMax);
-	//mChart->axes(Qt::Horizontal)[0]->setRange(xMin + 1.0, xMax + 1.0);
-	mChart->axes(Qt::Vertical)[0]->setRange(yMin, yMax);
+	scheduleRefresh();
 }
 
 void QDEHistoryChartPanel::reset()
 {
+	mRefreshTimer.stop();
+	mFollowing = true;
+	for (QList<QPointF> & points : mPoints) {
+		points.clear();
+	}
 	mBestData->clear();
 	mMedianData->clear();
 	mWorstData->clear();
-	mChart->axes(Qt::Horizontal)[0]->setRange(0.0, 1.0);
-	mChart->axes(Qt::Vertical)[0]->setRange(0.0, 1.0);
+	applyRange(0.0, 1.0, 0.0, 1.0);
+}
+
+void QDEHistoryChartPanel::resizeEvent(QResizeEvent * event)
+{
+	QChartView::resizeEvent(event);
+	// the number of buckets follows the plot width
+	scheduleRefresh();
+}
+
+void QDEHistoryChartPanel::mouseDoubleClickEvent(QMouseEvent * event)
+{
+	mFollowing = true;
+	scheduleRefresh();
+	QChartView::mouseDoubleClickEvent(event);
+}
+
+void QDEHistoryChartPanel::horizontalRangeChanged()
+{
+	if (!mApplyingRange) {
+		// the user zoomed: keep the chosen interval
+		mFollowing = false;
+		scheduleRefresh();
+	}
+}
+
+void QDEHistoryChartPanel::scheduleRefresh()
+{
+	if (!mRefreshTimer.isActive()) {
+		mRefreshTimer.start();
+	}
+}
+
+void QDEHistoryChartPanel::refresh()
+{
+	FitnessHistory const & history{ mDEAdapter.fitnessHistory() };
+	if (history.size() == 0) {
+		return;
+	}
+
+	// visible generations: the whole history, or the interval chosen by the user
+	double xMin, xMax, yMin, yMax;
+	history.getRange(xMin, xMax, yMin, yMax);
+	QValueAxis const * horizontalAxis{ static_cast<QValueAxis *>(mChart->axes(Qt::Horizontal)[0]) };
+	if (!mFollowing && horizontalAxis->min() <= xMin && horizontalAxis->max() >= xMax) {
+		mFollowing = true;
+	}
+	if (!mFollowing) {
+		xMin = horizontalAxis->min();
+		xMax = horizontalAxis->max();
+	}
+	size_t const firstGeneration{ static_cast<size_t>(std::max(0.0, std::floor(xMin))) };
+	size_t const lastGeneration{ static_cast<size_t>(std::max(0.0, std::ceil(xMax))) };
+
+	// one bucket per pixel column
+	size_t const bucketCount{ static_cast<size_t>(std::max(1.0, mChart->plotArea().width())) };
+	double const bucketWidth{ std::max(1.0, static_cast<double>(lastGeneration - firstGeneration + 1) / static_cast<double>(bucketCount)) };
+
+	// first entry overlapping the visible interval (the entries are in chronological order)
+	size_t first{};
+	size_t last{ history.size() };
+	while (first < last) {
+		size_t const middle{ first + (last - first) / 2 };
+		if (history[middle].generation + history[middle].count <= firstGeneration) {
+			first = middle + 1;
+		} else {
+			last = middle;
+		}
+	}
+
+	for (QList<QPointF> & points : mPoints) {
+		points.clear();
+		points.reserve(2 * bucketCount + 2);
+	}
+	double low{ std::numeric_limits<double>::infinity() };
+	double high{ -std::numeric_limits<double>::infinity() };
+	FitnessHistory::Entry bucket;
+	size_t bucketIndex{};
+	bool bucketOpen{};
+	for (size_t i{ first }; i < history.size() && history[i].generation <= lastGeneration; ++i) {
+		FitnessHistory::Entry const & entry{ history[i] };
+		size_t const offset{ entry.generation > firstGeneration ? entry.generation - firstGeneration : 0 };
+		size_t const index{ static_cast<size_t>(static_cast<double>(offset) / bucketWidth) };
+		if (bucketOpen && index == bucketIndex) {
+			bucket.merge(entry);
+		} else {
+			if (bucketOpen) {
+				appendBucket(bucket, low, high);
+			}
+			bucket = entry;
+			bucketIndex = index;
+			bucketOpen = true;
+		}
+	}
+	if (bucketOpen) {
+		appendBucket(bucket, low, high);
+	}
+
+	// one batched replacement per series
+	mBestData->replace(mPoints[static_cast<size_t>(FitnessHistory::Series::Best)]);
+	mMedianData->replace(mPoints[static_cast<size_t>(FitnessHistory::Series::Median)]);
+	mWorstData->replace(mPoints[static_cast<size_t>(FitnessHistory::Series::Worst)]);
+
+	if (low > high) {
+		low = 0.0;
+		high = 1.0;
+	}
+	applyRange(xMin, xMax, low, high);
+}
+
+void QDEHistoryChartPanel::appendBucket(FitnessHistory::Entry const & bucket, double & yMin, double & yMax)
+{
+	double const first{ static_cast<double>(bucket.generation) };
+	double const last{ static_cast<double>(bucket.generation + bucket.count - 1) };
+	for (size_t s{}; s < FitnessHistory::seriesCount; ++s) {
+		FitnessHistory::Envelope const & values{ bucket.values[s] };
+		if (bucket.count == 1 || values.minimum == values.maximum) {
+			mPoints[s].append(QPointF(last, values.last));
+		} else if (values.maximum - values.last < values.last - values.minimum) {
+			// the bucket ends near its maximum: draw the minimum first
+			mPoints[s].append(QPointF(first, values.minimum));
+			mPoints[s].append(QPointF(last, values.maximum));
+		} else {
+			mPoints[s].append(QPointF(first, values.maximum));
+			mPoints[s].append(QPointF(last, values.minimum));
+		}
+		yMin = std::min(yMin, values.minimum);
+		yMax = std::max(yMax, values.maximum);
+	}
+}
+
+void QDEHistoryChartPanel::applyRange(double xMin, double xMax, double yMin, double yMax)
+{
+	mApplyingRange = true;
+	mChart->axes(Qt::Horizontal)[0]->setRange(xMin, xMax);
+	mChart->axes(Qt::Vertical)[0]->setRange(yMin, yMax);
+	mApplyingRange = false;
 }
 
 void QDEHistoryChartPanel::setupGUI()
@@ -59,6 +198,10 @@ void QDEHistoryChartPanel::setupGUI()
 
 	setChart(mChart);
 	setRenderHint(QPainter::Antialiasing);
+	setRubberBand(QChartView::HorizontalRubberBand);
+
+	mRefreshTimer.setSingleShot(true);
+	mRefreshTimer.setInterval(sRefreshInterval);
 }
 
 void QDEHistoryChartPanel::assemblingAndLayouting()
@@ -70,6 +213,8 @@ void QDEHistoryChartPanel::establishConnections()
 {
 	connect(&mDEAdapter, &QDEAdapter::oneEvolutionStepped, this, &QDEHistoryChartPanel::updateHistory);
 	connect(&mDEAdapter, &QDEAdapter::wasReset, this, &QDEHistoryChartPanel::reset);
+	connect(&mRefreshTimer, &QTimer::timeout, this, &QDEHistoryChartPanel::refresh);
+	connect(static_cast<QValueAxis *>(mChart->axes(Qt::Horizontal)[0]), &QValueAxis::rangeChanged, this, &QDEHistoryChartPanel::horizontalRangeChanged);
 }
 
 
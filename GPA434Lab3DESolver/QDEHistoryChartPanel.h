@@ -4,11 +4,27 @@
 #include <QChartView>
 #include <QChart>
 #include <QLineSeries>
+#include <QList>
+#include <QPointF>
+#include <QTimer>
+#include <array>
+#include "FitnessHistory.h"
 
 class QDEAdapter;
 
 
 //! \brief Panneau affichant l'historique de performance pendant l'évolution.
+//!
+//! \details Les séries ne reçoivent pas un point par génération. À la 
+//! cadence d'affichage, l'intervalle de générations visible est découpé en 
+//! autant de groupes que la zone de tracé compte de pixels de largeur. 
+//! Chaque groupe est représenté par le minimum et le maximum de ses 
+//! générations : le nombre de points affichés reste borné par la largeur 
+//! du graphique, quel que soit le nombre de générations.
+//!
+//! Un glissement horizontal de la souris agrandit un intervalle, qui est 
+//! alors affiché avec toute la résolution conservée par FitnessHistory. 
+//! Un double-clic revient à l'affichage complet, qui suit l'évolution.
 class QDEHistoryChartPanel : public QChartView
 {
 	Q_OBJECT
@@ -25,12 +41,30 @@ public slots:
 	void updateHistory();
 	void reset();
 
+protected:
+	void resizeEvent(QResizeEvent * event) override;
+	void mouseDoubleClickEvent(QMouseEvent * event) override;
+
+private slots:
+	void refresh();
+	void horizontalRangeChanged();
+
 private:
 	QDEAdapter const& mDEAdapter;
 	QChart * mChart{};
 	QLineSeries * mBestData{};
 	QLineSeries * mMedianData{};
 	QLineSeries * mWorstData{};
+	QTimer mRefreshTimer;
+	bool mFollowing{ true };				// the whole history is shown and follows the evolution
+	bool mApplyingRange{};					// the range change comes from refresh, not from the user
+	std::array<QList<QPointF>, FitnessHistory::seriesCount> mPoints; // reused between refreshes
+
+	static const int sRefreshInterval;
+
+	void scheduleRefresh();
+	void appendBucket(FitnessHistory::Entry const & bucket, double & yMin, double & yMax);
+	void applyRange(double xMin, double xMax, double yMin, double yMax);
 
 	void setupGUI();
 	void assemblingAndLayouting();
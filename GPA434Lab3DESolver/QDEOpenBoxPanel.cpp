@@ -10,6 +10,7 @@
 #include <QPainter>
 
 #include "QImageViewer.h"
+#include "OpenBoxSolution.h"
 
 
 QDEOpenBoxPanel::QDEOpenBoxPanel(QWidget * parent)
@@ -54,7 +55,7 @@ double QDEOpenBoxPanel::boxHeight() const
 
 de::SolutionStrategy* QDEOpenBoxPanel::buildSolution() const
 {
-	return new OpenBoxStrategy(mWidthScrollBar->value(), mHeightScrollBar->value());
+	return new OpenBoxSolution(mWidthScrollBar->value(), mHeightScrollBar->value());
 }
 
 QHBoxLayout * QDEOpenBoxPanel::buildScrollBarLayout(QScrollBar * & sb)
@@ -96,9 +97,16 @@ void QDEOpenBoxPanel::updateVisualization(QDEAdapter const & de)
 	static double const smallOffset{ 10.0 };
 	static double const bigSmallRatio{ 3.0 };
 
+	// the population view is shared with the adapter snapshot: no copy
+	std::shared_ptr<de::Population const> const populationView{ de.actualPopulation() };
+	de::Population const & population{ *populationView };
+	if (population.size() == 0) {
+		return;
+	}
+
 	// process dimensions for all boxes drawing
 	QSize const labelImageSize(mVisualizationLabel->size().width() - 1, mVisualizationLabel->size().height() - 1);
-	double const smallGridCount{ std::ceil(std::sqrt(de.actualPopulation().size() - 1)) };
+	double const smallGridCount{ std::ceil(std::sqrt(population.size() - 1)) };
 	double const hRatio{ (labelImageSize.width() - (smallGridCount + 1) * smallOffset) / smallGridCount };
 	double const vRatio{ (labelImageSize.height() - smallGridCount * smallOffset - 2.0 * bigOffset) / (smallGridCount + bigSmallRatio) };
 	double const imageSize{ std::min(hRatio, vRatio) };
@@ -115,12 +123,12 @@ void QDEOpenBoxPanel::updateVisualization(QDEAdapter const & de)
 	painter.setBrush(boxColor);
 
 	// draw all boxes
-	drawBox(painter, bigImageCenter, bigImageSize, de.actualPopulation()[0][0]);
-	for (size_t i{ 1 }; i < de.actualPopulation().size(); ++i) {
+	drawBox(painter, bigImageCenter, bigImageSize, population[0][0]);
+	for (size_t i{ 1 }; i < population.size(); ++i) {
 		size_t row{ (i - 1) / static_cast<size_t>(smallGridCount) };
 		size_t column{ (i - 1) % static_cast<size_t>(smallGridCount) };
 		QPointF rowColOffset(column * (smallImageSize + smallOffset), row * (smallImageSize + smallOffset));
-		drawBox(painter, smallUpperLeftImageCenter + rowColOffset, smallImageSize, de.actualPopulation()[i][0]);
+		drawBox(painter, smallUpperLeftImageCenter + rowColOffset, smallImageSize, population[i][0]);
 	}
 
 	// update the label
@@ -163,63 +171,3 @@ void QDEOpenBoxPanel::drawBox(QPainter & painter, QPointF const & boxCenterPos,
 	painter.restore();
 }
 
-
-
-
-
-
-
-
-
-#include <OptimizationMaximization.h>
-#include <FitnessIdentity.h>
-#include <format>
-
-
-static const std::string obp_title("Boîte ouverte");
-static const std::string obp_summary("<p>Le problème de la boîte ouverte consiste à déterminer la taille de la coupe au quatre coins d'une surface rectangulaire permettant d'optimizer le volume de la boîte issue du pliage de cette feuille.</p>");
-static const std::string obp_description(R".(<p>Ce problème se résoud dans un espace à une dimension, représantant la taille de la coupe 'cut' au quatre coins de la surface rectangulaire.</p>
-
-<p>Le domaine de cette dimension correspond aux tailles possible de la coupe. Elle doit être comprise entre 0 et la moitié de la plus petite dimension de la surface rectangulaire. Théoriquement, les bornes devraient être excluses c = ]0, min(width, height) / 2[.</p>
-
-<p>La fonction objective est le volume de la boîte issue de la coupe.<br/>
-f(cut) = (width - 2 * cut) * (height - 2 * cut) * cut</p>).");
-
-
-QDEOpenBoxPanel::OpenBoxStrategy::OpenBoxStrategy(double width, double height)
-	: SolutionStrategy(obp_title, obp_summary, obp_description)
-	, mWidth{ width }
-	, mHeight{ height }
-{
-	// domain definition
-	mSolutionDomain.resize(1);
-	mSolutionDomain[0].set(0.0, std::min(height, width) / 2.0);
-	
-	// strategies definition
-	setOptimizationStrategy(new de::OptimizationMaximization);
-	setFitnessStrategy(new de::FitnessIdentity);
-}
-
-std::string QDEOpenBoxPanel::OpenBoxStrategy::toString(de::Solution const & solution) const
-{
-	// return the solution as a formatted string
-	return std::format(R"...(
-Taille de la feuille : {} x {}
-Taille de la coupe   : {:0.6f} x {:0.6f}
-Volume de la boite   : {:0.6f})...", mWidth, mHeight, solution[0], solution[0], solution.fitness());
-}
-
-double QDEOpenBoxPanel::OpenBoxStrategy::process(de::Solution const & solution)
-{
-	// assign a local variable for the cut size - only for readability
-	double cut{ solution[0] };
-
-	// validate if the solution is inside the domain
-	if (!mSolutionDomain[0].validate(cut)) {
-		return 0.0;
-	}
-
-	// process the volume of the box
-	return cut * (mWidth - 2.0 * cut) * (mHeight - 2.0 * cut);
-}
-
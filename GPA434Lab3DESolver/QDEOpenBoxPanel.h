@@ -98,35 +98,5 @@ private:
 	QHBoxLayout * buildScrollBarLayout(QScrollBar * & sb);
 	void drawBox(QPainter & painter, QPointF const & boxCenterPos, double boxSize, double cutSize);
 
-	class OpenBoxStrategy;
-
 	static const QString sDescription;
 };
-
-
-
-
-//! \brief Classe représentant une stratégie de solution pour la 
-//! résolution du problème de la boîte ouverte.
-class QDEOpenBoxPanel::OpenBoxStrategy : public de::SolutionStrategy
-{
-public:
-	OpenBoxStrategy(double width = 1.0, double height = 1.0);
-	OpenBoxStrategy(OpenBoxStrategy const &) = default;
-	OpenBoxStrategy(OpenBoxStrategy &&) = default;
-	OpenBoxStrategy& operator=(OpenBoxStrategy const &) = default;
-	OpenBoxStrategy& operator=(OpenBoxStrategy &&) = default;
-	~OpenBoxStrategy() override = default;
-
-	std::string toString(de::Solution const & ag) const override;
-
-	DEFINE_OVERRIDE_CLONE_METHOD(OpenBoxStrategy)	     //!< Macro définissant automatiquement la substitution de la méthode de clonage.
-
-protected:
-	double process(de::Solution const & ag) override;
-
-private:
-	double mWidth;
-	double mHeight;
-};
-
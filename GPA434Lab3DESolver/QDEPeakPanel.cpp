@@ -93,47 +93,75 @@ QDEPeakPanel::PeakMode QDEPeakPanel::currentMode() const
 void QDEPeakPanel::updateVisualization(QDEAdapter const & de)
 {
 	if (mMeshAvailable) {
-		// Approche VRAIMENT inefficace => to do => doit réutiliser les points existants si la population ne change pas
-		mSurface->removeCustomItems();
-
-		switch (currentMode()) {
-			case PeakMode::Minimum:
-				for (size_t i{}; i < de.actualPopulation().size(); ++i) {
-					addPoint(de.actualPopulation()[i][0], de.actualPopulation()[i][1], false);
-				}
-				break;
-			case PeakMode::Maximum:
-				for (size_t i{}; i < de.actualPopulation().size(); ++i) {
-					addPoint(de.actualPopulation()[i][0], de.actualPopulation()[i][1], true);
-				}
-				break;
-			case PeakMode::MinMax:
-			default:
-				for (size_t i{}; i < de.actualPopulation().size(); ++i) {
-					addPoint(de.actualPopulation()[i][0], de.actualPopulation()[i][1], true);
-					addPoint(de.actualPopulation()[i][2], de.actualPopulation()[i][3], false);
-				}
-				break;
-		}
+		// the population view is shared with the adapter snapshot: no copy
+		std::shared_ptr<de::Population const> const populationView{ de.actualPopulation() };
+		gatherPoints(*populationView);
+		updatePoints();
 	}
 }
 
-void QDEPeakPanel::addPoint(qreal x, qreal z, bool maximumPoint)
+void QDEPeakPanel::gatherPoints(de::Population const & population)
 {
-	addPoint(x, de::PeakFunctionSolution::peak(x, z), z, maximumPoint);
+	mPointData.clear();
+	mPointData.reserve(currentMode() == PeakMode::MinMax ? 2 * population.size() : population.size());
+
+	switch (currentMode()) {
+		case PeakMode::Minimum:
+			for (size_t i{}; i < population.size(); ++i) {
+				mPointData.push_back({ population[i][0], 0.0, population[i][1], false });
+			}
+			break;
+		case PeakMode::Maximum:
+			for (size_t i{}; i < population.size(); ++i) {
+				mPointData.push_back({ population[i][0], 0.0, population[i][1], true });
+			}
+			break;
+		case PeakMode::MinMax:
+		default:
+			for (size_t i{}; i < population.size(); ++i) {
+				mPointData.push_back({ population[i][0], 0.0, population[i][1], true });
+				mPointData.push_back({ population[i][2], 0.0, population[i][3], false });
+			}
+			break;
+	}
+
+	// evaluate all heights in one tight pass, before touching any 3D item
+	for (PointData & point : mPointData) {
+		point.y = de::PeakFunctionSolution::peak(point.x, point.z);
+	}
 }
 
-void QDEPeakPanel::addPoint(qreal x, qreal y, qreal z, bool maximumPoint)
+void QDEPeakPanel::updatePoints()
 {
-	QCustom3DItem * point{ new QCustom3DItem };
-	point->setMeshFile(mMeshFileName);
-
-	point->setTextureImage(maximumPoint ? mMaxColor : mMinColor);
+	// grow the pool only when the population is larger than ever displayed
+	while (mPointPool.size() < mPointData.size()) {
+		QCustom3DItem * item{ new QCustom3DItem };
+		item->setMeshFile(mMeshFileName);
+		item->setScaling(QVector3D(sMeshScale, sMeshScale, sMeshScale));
+		item->setTextureImage(mMinColor);
+		mSurface->addCustomItem(item);
+		mPointPool.push_back({ item, false });
+	}
 
-	point->setPosition(QVector3D(z, y + sMeshOffset, x));
-	point->setScaling(QVector3D(sMeshScale, sMeshScale, sMeshScale));
+	// move the used items, hide the others
+	for (size_t i{}; i < mPointData.size(); ++i) {
+		PointData const & point{ mPointData[i] };
+		PooledPoint & pooled{ mPointPool[i] };
+		setPointColor(pooled, point.maximumPoint);
+		pooled.item->setPosition(QVector3D(point.z, point.y + sMeshOffset, point.x));
+		pooled.item->setVisible(true);
+	}
+	for (size_t i{ mPointData.size() }; i < mPointPool.size(); ++i) {
+		mPointPool[i].item->setVisible(false);
+	}
+}
 
-	mSurface->addCustomItem(point);
+void QDEPeakPanel::setPointColor(PooledPoint & point, bool maximumPoint)
+{
+	if (point.maximumPoint != maximumPoint) {
+		point.item->setTextureImage(maximumPoint ? mMaxColor : mMinColor);
+		point.maximumPoint = maximumPoint;
+	}
 }
 
 void QDEPeakPanel::setupMeshElements()
@@ -5,6 +5,7 @@
 #include <QtDataVisualization>
 #include <Q3DSurface>
 #include <QTimer>
+#include <vector>
 
 
 class QRadioButton;
@@ -48,6 +49,23 @@ private:
 	QImage mMaxColor;
 	QTimer mAutoRotateTimer;
 
+	// One displayed individual (x, z from the genes, y from the peak function).
+	struct PointData
+	{
+		qreal x{};
+		qreal y{};
+		qreal z{};
+		bool maximumPoint{};
+	};
+	// One item of the pool, owned by mSurface; its color is kept to avoid re-uploading the texture.
+	struct PooledPoint
+	{
+		QCustom3DItem * item{};
+		bool maximumPoint{};
+	};
+	std::vector<PointData> mPointData;		// reused between frames
+	std::vector<PooledPoint> mPointPool;	// items are moved, never recreated
+
 	static const size_t sXRes, sZRes;
 	static const qreal sXMin, sXMax, sZMin, sZMax;
 	static const QString sInternalResourceMeshFileName;
@@ -58,8 +76,9 @@ private:
 	static const qreal sMeshScale;
 	static const float sAutoRotateSpeed;
 
-	void addPoint(qreal x, qreal z, bool maximumPoint);
-	void addPoint(qreal x, qreal y, qreal z, bool maximumPoint);
+	void gatherPoints(de::Population const & population);
+	void updatePoints();
+	void setPointColor(PooledPoint & point, bool maximumPoint);
 
 	void setupMeshElements();
 	void setupSurface();
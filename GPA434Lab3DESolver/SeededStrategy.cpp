@@ -0,0 +1,38 @@
+#include "SeededStrategy.h"
+
+
+SeededStrategy::SeededStrategy(uint64_t seed)
+	: mRandom(seed)
+{
+}
+
+uint64_t SeededStrategy::seed() const
+{
+	return mRandom.seed();
+}
+
+void SeededStrategy::setSeed(uint64_t seed)
+{
+	mRandom.setSeed(seed);
+	mGeneration = 0;
+}
+
+CounterBasedRandom const & SeededStrategy::random() const
+{
+	return mRandom;
+}
+
+uint32_t SeededStrategy::generation() const
+{
+	return mGeneration;
+}
+
+void SeededStrategy::setGeneration(uint32_t generation)
+{
+	mGeneration = generation;
+}
+
+void SeededStrategy::nextGeneration()
+{
+	++mGeneration;
+}
@@ -0,0 +1,53 @@
+#pragma once
+#ifndef SEEDED_STRATEGY_H
+#define SEEDED_STRATEGY_H
+
+
+#include <cstdint>
+#include "CounterBasedRandom.h"
+
+
+//! \brief Classe de base (_mixin_) des stratégies utilisant le générateur 
+//! CounterBasedRandom plutôt que les générateurs statiques de `delib`.
+//!
+//! \details Les stratégies de `delib` (MutationStrategy, CrossoverStrategy 
+//! et Interval) partagent des instances statiques de 
+//! `std::default_random_engine`. Elles ne peuvent donc pas être utilisées 
+//! simultanément par plusieurs fils d'exécution et leurs résultats dépendent 
+//! de tout ce qui a été tiré auparavant dans le processus.
+//! 
+//! Une stratégie héritant aussi de SeededStrategy tire tous ses nombres 
+//! aléatoires d'un générateur à compteur dont la clé est le germe. Le 
+//! compteur est formé de la génération courante (incrémentée à chaque appel 
+//! de `process`), de l'individu et du gène. Pour un même germe, une 
+//! simulation est ainsi entièrement reproductible, peu importe le nombre de 
+//! fils d'exécution.
+//! 
+//! Il est possible de reconnaître ces stratégies par un `dynamic_cast` 
+//! vers SeededStrategy, par exemple pour leur assigner un germe.
+class SeededStrategy
+{
+public:
+	SeededStrategy(uint64_t seed = 0);									//!< Constructeur avec initialisation du germe.
+	SeededStrategy(SeededStrategy const &) = default;					//!< Constructeur de copie.
+	SeededStrategy(SeededStrategy &&) = default;						//!< Constructeur de déplacement.
+	SeededStrategy& operator=(SeededStrategy const &) = default;		//!< Opérateur d'assignation de copie.
+	SeededStrategy& operator=(SeededStrategy &&) = default;				//!< Opérateur d'assignation de déplacement.
+	virtual ~SeededStrategy() = default;								//!< Destructeur virtuel.
+
+	uint64_t seed() const;												//!< Retourne le germe de la stratégie.
+	void setSeed(uint64_t seed);										//!< Détermine le germe de la stratégie et remet le compteur de génération à zéro.
+	uint32_t generation() const;										//!< Retourne le numéro de génération utilisé comme compteur.
+	void setGeneration(uint32_t generation);							//!< Détermine le compteur de génération, par exemple pour reprendre une simulation sauvegardée.
+
+protected:
+	CounterBasedRandom const & random() const;							//!< Retourne le générateur à compteur.
+	void nextGeneration();												//!< Passe à la génération suivante. À appeler une fois à la fin de chaque `process`.
+
+private:
+	CounterBasedRandom mRandom;
+	uint32_t mGeneration{};
+};
+
+
+#endif // SEEDED_STRATEGY_H
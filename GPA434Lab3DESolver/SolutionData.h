@@ -0,0 +1,34 @@
+#pragma once
+#ifndef SOLUTION_DATA_H
+#define SOLUTION_DATA_H
+
+
+#include <Solution.h>
+
+
+//! \brief Retourne un pointeur vers les valeurs contiguës d'une solution, 
+//! ou nullptr si la solution est vide.
+//!
+//! \details Les valeurs d'une `de::Solution` sont stockées dans un 
+//! `std::vector<double>`. L'accès par `operator[]` est une fonction non 
+//! intégrée de `delib` : l'appeler à chaque gène coûte un appel de fonction 
+//! par valeur. Ces fonctions donnent plutôt accès à la rangée complète pour 
+//! les boucles des stratégies.
+//!
+//! La version constante passe par l'opérateur non constant, car 
+//! `de::Solution` ne retourne que des copies en lecture constante. Les 
+//! populations de l'engin ne sont jamais des objets constants et la valeur 
+//! n'est jamais modifiée par ce pointeur.
+inline double * solutionData(de::Solution & solution)
+{
+	return solution.size() > 0 ? &solution[0] : nullptr;
+}
+
+//! \brief Version en lecture seule de solutionData.
+inline double const * solutionData(de::Solution const & solution)
+{
+	return solutionData(const_cast<de::Solution &>(solution));
+}
+
+
+#endif // SOLUTION_DATA_H
@@ -0,0 +1,222 @@
+#include "BenchmarkFunctionSolution.h"
+
+
+#include <algorithm>
+#include <cmath>
+#include <format>
+#include <limits>
+#include <numbers>
+
+#include <Solution.h>
+#include <OptimizationMinimization.h>
+#include <FitnessIdentity.h>
+#include <InitializationDomainUniform.h>
+#include <AdaptiveDomainClamped.h>
+#include <MutationRand1.h>
+#include <CrossoverBinomial.h>
+#include <SelectionBestFitness.h>
+
+#include "CounterBasedRandom.h"
+#include "SolutionData.h"
+
+
+BenchmarkFunctionSolution::BenchmarkFunctionSolution(std::string const & name, std::string const & summary, std::string const & description, size_t dimension, double lower, double upper, double optimumCoordinate)
+	: SolutionStrategy(name, summary, description)
+	, mDimension{ std::max<size_t>(dimension, 1) }
+	, mOptimumCoordinate{ optimumCoordinate }
+{
+	// domain definition
+	mSolutionDomain.resize(mDimension, lower, upper);
+
+	// strategies definition
+	setOptimizationStrategy(new de::OptimizationMinimization);
+	setFitnessStrategy(new de::FitnessIdentity);
+}
+
+size_t BenchmarkFunctionSolution::dimension() const
+{
+	return mDimension;
+}
+
+double BenchmarkFunctionSolution::optimum() const
+{
+	return 0.0;
+}
+
+std::vector<double> BenchmarkFunctionSolution::optimumLocation() const
+{
+	if (isShifted()) {
+		return mTransform->shift;
+	}
+	return std::vector<double>(mDimension, mOptimumCoordinate);
+}
+
+bool BenchmarkFunctionSolution::isShifted() const
+{
+	return mTransform && !mTransform->shift.empty();
+}
+
+bool BenchmarkFunctionSolution::isRotated() const
+{
+	return mTransform && !mTransform->rotation.empty();
+}
+
+void BenchmarkFunctionSolution::setShift(uint64_t seed)
+{
+	CounterBasedRandom const random(seed);
+	std::vector<double> shift(mDimension);
+	for (size_t j{}; j < mDimension; ++j) {
+		double const lower{ mSolutionDomain[j].lower() };
+		double const margin{ (mSolutionDomain[j].upper() - lower) * 0.1 };
+		shift[j] = random.uniform(lower + margin, mSolutionDomain[j].upper() - margin, 0, sShiftStream, 0, static_cast<uint32_t>(j));
+	}
+
+	setTransform(std::move(shift), isRotated() ? mTransform->rotation : std::vector<double>{});
+}
+
+void BenchmarkFunctionSolution::setRotation(uint64_t seed)
+{
+	// Gaussian matrix (Box-Muller) orthonormalized by modified Gram-Schmidt: the rows are uniformly distributed on the sphere
+	CounterBasedRandom const random(seed);
+	size_t const n{ mDimension };
+	std::vector<double> rotation(n * n);
+	for (size_t i{}; i < n; ++i) {
+		for (size_t j{}; j < n; ++j) {
+			uint32_t const row{ static_cast<uint32_t>(i) };
+			uint32_t const column{ static_cast<uint32_t>(j) };
+			double const u1{ 1.0 - CounterBasedRandom::toUnit(random.bits(0, sRotationStream, row, column, 0)) };
+			double const u2{ CounterBasedRandom::toUnit(random.bits(0, sRotationStream, row, column, 1)) };
+			rotation[i * n + j] = std::sqrt(-2.0 * std::log(u1)) * std::cos(2.0 * std::numbers::pi * u2);
+		}
+	}
+
+	for (size_t i{}; i < n; ++i) {
+		double * row{ &rotation[i * n] };
+		for (size_t k{}; k < i; ++k) {
+			double const * previous{ &rotation[k * n] };
+			double dot{};
+			for (size_t j{}; j < n; ++j) dot += row[j] * previous[j];
+			for (size_t j{}; j < n; ++j) row[j] -= dot * previous[j];
+		}
+		double norm{};
+		for (size_t j{}; j < n; ++j) norm += row[j] * row[j];
+		norm = std::sqrt(norm);
+		for (size_t j{}; j < n; ++j) row[j] /= norm;
+	}
+
+	setTransform(isShifted() ? mTransform->shift : std::vector<double>{}, std::move(rotation));
+}
+
+void BenchmarkFunctionSolution::clearTransform()
+{
+	mTransform.reset();
+}
+
+void BenchmarkFunctionSolution::setTransform(std::vector<double> shift, std::vector<double> rotation)
+{
+	mTransform = std::make_shared<Transform const>(Transform{ std::move(shift), std::move(rotation) });
+}
+
+double BenchmarkFunctionSolution::evaluate(double const * genes) const
+{
+	double objective;
+	evaluate(genes, 1, &objective);
+	return objective;
+}
+
+void BenchmarkFunctionSolution::evaluate(double const * genes, size_t count, double * objectives) const
+{
+	size_t const n{ mDimension };
+	if (!mTransform) {
+		for (size_t r{}; r < count; ++r) {
+			objectives[r] = function(genes + r * n, n);
+		}
+		return;
+	}
+
+	// one pair of buffers per thread, shared by every row: no allocation once they have grown to the problem size
+	thread_local std::vector<double> buffer;
+	thread_local std::vector<double> rotated;
+	buffer.resize(n);
+	rotated.resize(n);
+	for (size_t r{}; r < count; ++r) {
+		transform(genes + r * n, buffer.data(), rotated.data());
+		objectives[r] = function(buffer.data(), n);
+	}
+}
+
+void BenchmarkFunctionSolution::transform(double const * genes, double * z, double * rotated) const
+{
+	size_t const n{ mDimension };
+
+	if (isShifted()) {
+		double const * shift{ mTransform->shift.data() };
+		for (size_t j{}; j < n; ++j) z[j] = genes[j] - shift[j];
+	} else {
+		for (size_t j{}; j < n; ++j) z[j] = genes[j] - mOptimumCoordinate;
+	}
+
+	if (isRotated()) {
+		double const * rotation{ mTransform->rotation.data() };
+		for (size_t i{}; i < n; ++i) {
+			double const * row{ rotation + i * n };
+			double sum{};
+			for (size_t j{}; j < n; ++j) sum += row[j] * z[j];
+			rotated[i] = sum;
+		}
+		std::copy_n(rotated, n, z);
+	}
+
+	for (size_t j{}; j < n; ++j) z[j] += mOptimumCoordinate;
+}
+
+std::string BenchmarkFunctionSolution::toString(de::Solution const & solution) const
+{
+	if (solution.size() >= mDimension) {
+		return describe(solutionData(solution), solution.objective());
+	}
+	// missing genes are taken at the optimum: they add nothing to the distance
+	std::vector<double> genes{ optimumLocation() };
+	std::copy_n(solutionData(solution), solution.size(), genes.begin());
+	return describe(genes.data(), solution.objective());
+}
+
+std::string BenchmarkFunctionSolution::describe(double const * genes, double objective) const
+{
+	std::vector<double> const location{ optimumLocation() };
+	double distance{};
+	for (size_t j{}; j < mDimension; ++j) {
+		double const delta{ genes[j] - location[j] };
+		distance += delta * delta;
+	}
+
+	// return the solution as a formatted string
+	return std::format(R"...(
+Fonction             : {} (D = {}{}{})
+Valeur objective     : {:0.6e}
+Écart à l'optimum    : {:0.6e}
+Distance à l'optimum : {:0.6e})...", name(), mDimension, isShifted() ? ", déplacée" : "", isRotated() ? ", tournée" : "", objective, objective - optimum(), std::sqrt(distance));
+}
+
+de::EngineParameters BenchmarkFunctionSolution::engineParameters() const
+{
+	de::EngineParameters parameters;
+	parameters.setPopulationSize(10 * mDimension);
+	parameters.setMaxGeneration(1000);
+	parameters.setInitializationStrategy(new de::InitializationDomainUniform);
+	parameters.setAdaptiveDomainStrategy(new de::AdaptiveDomainClamped);
+	parameters.setMutationStrategy(new de::MutationRand1);
+	parameters.setMutationFactor(0.5);
+	parameters.setCrossoverStrategy(new de::CrossoverBinomial);
+	parameters.setCrossoverRate(0.9);
+	parameters.setSelectionStrategy(new de::SelectionBestFitness);
+	return parameters;
+}
+
+double BenchmarkFunctionSolution::process(de::Solution const & solution)
+{
+	if (solution.size() != mDimension) {
+		return std::numeric_limits<double>::infinity();
+	}
+	return evaluate(solutionData(solution));
+}
@@ -0,0 +1,83 @@
+#pragma once
+#ifndef BENCHMARK_FUNCTION_SOLUTION_H
+#define BENCHMARK_FUNCTION_SOLUTION_H
+
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <SolutionStrategy.h>
+
+
+//! \brief Classe de base des fonctions de test classiques (_benchmark_) 
+//! de dimension quelconque.
+//!
+//! \details Contrairement aux problèmes de l'application (1 à 4 
+//! dimensions), ces fonctions permettent de mesurer le comportement de 
+//! l'engin sur des espaces de 10 à 1000 dimensions. Toutes sont des 
+//! problèmes de minimisation dont l'optimum connu vaut 0.
+//! 
+//! Chaque fonction peut être déplacée (_shifted_) et tournée (_rotated_) :
+//! \f$z = R (x - o) + c\f$, où \f$o\f$ est la nouvelle position de 
+//! l'optimum, \f$R\f$ une matrice orthogonale aléatoire et \f$c\f$ la 
+//! position de l'optimum de la fonction d'origine. Le déplacement et la 
+//! rotation sont tirés d'un germe et partagés (sans copie) entre les clones.
+//! 
+//! Les fonctions `evaluate` travaillent directement sur des tableaux 
+//! contigus de gènes, sans passer par `de::Solution`. La version en lot 
+//! évalue plusieurs solutions rangées l'une après l'autre et réutilise les 
+//! tampons de la transformation d'une rangée à l'autre.
+class BenchmarkFunctionSolution : public de::SolutionStrategy
+{
+public:
+	BenchmarkFunctionSolution(std::string const & name, std::string const & summary, std::string const & description, size_t dimension, double lower, double upper, double optimumCoordinate = 0.0);
+	BenchmarkFunctionSolution(BenchmarkFunctionSolution const &) = default;				//!< Constructeur de copie.
+	BenchmarkFunctionSolution(BenchmarkFunctionSolution &&) = default;					//!< Constructeur de déplacement.
+	BenchmarkFunctionSolution& operator=(BenchmarkFunctionSolution const &) = delete;	//!< Opérateur d'assignation de copie supprimé (comme pour SolutionStrategy).
+	BenchmarkFunctionSolution& operator=(BenchmarkFunctionSolution &&) = delete;		//!< Opérateur d'assignation de déplacement supprimé (comme pour SolutionStrategy).
+	~BenchmarkFunctionSolution() override = default;									//!< Destructeur.
+
+	size_t dimension() const;															//!< Retourne la dimension du problème.
+	double optimum() const;																//!< Retourne la valeur objective de l'optimum global.
+	std::vector<double> optimumLocation() const;										//!< Retourne la position de l'optimum global (en tenant compte du déplacement).
+	bool isShifted() const;																//!< Indique si l'optimum est déplacé.
+	bool isRotated() const;																//!< Indique si l'espace est tourné.
+
+	void setShift(uint64_t seed);														//!< Déplace l'optimum à une position aléatoire tirée du germe (dans les 80 % centraux du domaine).
+	void setRotation(uint64_t seed);													//!< Tourne l'espace selon une matrice orthogonale aléatoire tirée du germe. Coûte O(D³) à la création.
+	void clearTransform();																//!< Retire le déplacement et la rotation.
+
+	double evaluate(double const * genes) const;										//!< Évalue la fonction sur `dimension()` gènes contigus.
+	void evaluate(double const * genes, size_t count, double * objectives) const;		//!< Évalue `count` solutions de `dimension()` gènes, contiguës l'une après l'autre, et écrit leur valeur objective dans `objectives`.
+	std::string describe(double const * genes, double objective) const;					//!< Décrit une solution donnée par `dimension()` gènes contigus et sa valeur objective.
+
+	std::string toString(de::Solution const & solution) const override;
+	de::EngineParameters engineParameters() const override;								//!< Retourne des paramètres adaptés à la dimension du problème.
+
+protected:
+	double process(de::Solution const & solution) override;
+
+	//! \brief Évalue la fonction d'origine (sans déplacement ni rotation) 
+	//! sur `count` valeurs contiguës.
+	virtual double function(double const * z, size_t count) const = 0;
+
+private:
+	struct Transform
+	{
+		std::vector<double> shift;			// o : position de l'optimum, vide si non déplacé
+		std::vector<double> rotation;		// R : matrice D x D par rangée, vide si non tourné
+	};
+
+	size_t mDimension;
+	double mOptimumCoordinate;
+	std::shared_ptr<Transform const> mTransform;
+
+	void setTransform(std::vector<double> shift, std::vector<double> rotation);
+	void transform(double const * genes, double * z, double * rotated) const;	// z = R (x - o) + c, `rotated` servant de tampon de travail
+
+	static constexpr uint32_t sShiftStream{ 0x53484654u };
+	static constexpr uint32_t sRotationStream{ 0x524F5441u };
+};
+
+
+#endif // BENCHMARK_FUNCTION_SOLUTION_H
@@ -0,0 +1,168 @@
+#include "BenchmarkFunctions.h"
+
+
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+
+
+static constexpr double twoPi{ 2.0 * std::numbers::pi };
+
+
+SphereSolution::SphereSolution(size_t dimension)
+	: BenchmarkFunctionSolution("Sphère", "Fonction de test unimodale et séparable.", "f(z) = somme des z² sur [-100, 100]^D. Mesure la vitesse de convergence pure de l'engin.", dimension, -100.0, 100.0)
+{
+}
+
+double SphereSolution::function(double const * z, size_t count) const
+{
+	double sum{};
+	for (size_t i{}; i < count; ++i) {
+		sum += z[i] * z[i];
+	}
+	return sum;
+}
+
+
+
+EllipsoidSolution::EllipsoidSolution(size_t dimension)
+	: BenchmarkFunctionSolution("Ellipsoïde", "Fonction de test unimodale mal conditionnée.", "f(z) = somme des 10^(6 i / (D - 1)) z² sur [-100, 100]^D. Le conditionnement de 10⁶ pénalise les mutations qui ne suivent pas les axes.", dimension, -100.0, 100.0)
+{
+}
+
+double EllipsoidSolution::function(double const * z, size_t count) const
+{
+	double const step{ count > 1 ? 6.0 / static_cast<double>(count - 1) : 0.0 };
+	double sum{};
+	for (size_t i{}; i < count; ++i) {
+		sum += std::pow(10.0, step * static_cast<double>(i)) * z[i] * z[i];
+	}
+	return sum;
+}
+
+
+
+RosenbrockSolution::RosenbrockSolution(size_t dimension)
+	: BenchmarkFunctionSolution("Rosenbrock", "Fonction de test en vallée courbe.", "f(z) = somme des 100 (z[i+1] - z[i]²)² + (1 - z[i])² sur [-5, 10]^D. L'optimum est en (1, ..., 1), au fond d'une vallée étroite et courbe.", dimension, -5.0, 10.0, 1.0)
+{
+}
+
+double RosenbrockSolution::function(double const * z, size_t count) const
+{
+	double sum{};
+	for (size_t i{ 1 }; i < count; ++i) {
+		double const valley{ z[i] - z[i - 1] * z[i - 1] };
+		double const distance{ 1.0 - z[i - 1] };
+		sum += 100.0 * valley * valley + distance * distance;
+	}
+	return sum;
+}
+
+
+
+RastriginSolution::RastriginSolution(size_t dimension)
+	: BenchmarkFunctionSolution("Rastrigin", "Fonction de test multimodale et régulière.", "f(z) = 10 D + somme des z² - 10 cos(2 pi z) sur [-5.12, 5.12]^D. Environ 10^D optima locaux disposés sur une grille.", dimension, -5.12, 5.12)
+{
+}
+
+double RastriginSolution::function(double const * z, size_t count) const
+{
+	double sum{ 10.0 * static_cast<double>(count) };
+	for (size_t i{}; i < count; ++i) {
+		sum += z[i] * z[i] - 10.0 * std::cos(twoPi * z[i]);
+	}
+	return sum;
+}
+
+
+
+AckleySolution::AckleySolution(size_t dimension)
+	: BenchmarkFunctionSolution("Ackley", "Fonction de test multimodale à entonnoir central.", "f(z) = -20 exp(-0.2 sqrt(moyenne des z²)) - exp(moyenne des cos(2 pi z)) + 20 + e sur [-32.768, 32.768]^D.", dimension, -32.768, 32.768)
+{
+}
+
+double AckleySolution::function(double const * z, size_t count) const
+{
+	double sum2{};
+	double sumCos{};
+	for (size_t i{}; i < count; ++i) {
+		sum2 += z[i] * z[i];
+		sumCos += std::cos(twoPi * z[i]);
+	}
+	double const n{ static_cast<double>(count) };
+	// clamped at 0 since the last rounding may give a tiny negative value at the optimum
+	return std::max(0.0, -20.0 * std::exp(-0.2 * std::sqrt(sum2 / n)) - std::exp(sumCos / n) + 20.0 + std::numbers::e);
+}
+
+
+
+GriewankSolution::GriewankSolution(size_t dimension)
+	: BenchmarkFunctionSolution("Griewank", "Fonction de test multimodale non séparable.", "f(z) = 1 + somme des z² / 4000 - produit des cos(z[i] / sqrt(i)) sur [-600, 600]^D.", dimension, -600.0, 600.0)
+{
+}
+
+double GriewankSolution::function(double const * z, size_t count) const
+{
+	double sum{};
+	double product{ 1.0 };
+	for (size_t i{}; i < count; ++i) {
+		sum += z[i] * z[i];
+		product *= std::cos(z[i] / std::sqrt(static_cast<double>(i + 1)));
+	}
+	return 1.0 + sum / 4000.0 - product;
+}
+
+
+
+SchwefelSolution::SchwefelSolution(size_t dimension)
+	: BenchmarkFunctionSolution("Schwefel", "Fonction de test multimodale trompeuse.", "f(z) = 418.9829 D - somme des z sin(sqrt(|z|)) sur [-500, 500]^D. Le deuxième meilleur optimum est loin du global, situé près des bornes.", dimension, -500.0, 500.0, 420.96874635998202)
+{
+}
+
+double SchwefelSolution::function(double const * z, size_t count) const
+{
+	static constexpr double bound{ 500.0 };
+	double const n{ static_cast<double>(count) };
+	double sum{ 418.9828872724339 * n };
+	for (size_t i{}; i < count; ++i) {
+		double const zi{ z[i] };
+		if (std::abs(zi) <= bound) {
+			sum -= zi * std::sin(std::sqrt(std::abs(zi)));
+		} else {
+			// shifted or rotated, z leaves [-500, 500] where the function keeps going down:
+			// fold it back into the domain and add a quadratic penalty (as in CEC 2014)
+			double const excess{ std::abs(zi) - bound };
+			double const folded{ std::copysign(bound - std::fmod(std::abs(zi), bound), zi) };
+			sum -= folded * std::sin(std::sqrt(std::abs(folded))) - excess * excess / (10000.0 * n);
+		}
+	}
+	return sum;
+}
+
+
+
+LunacekSolution::LunacekSolution(size_t dimension)
+	: BenchmarkFunctionSolution("Lunacek", "Fonction de test bi-Rastrigin à deux entonnoirs.", "f(z) = min(somme des (z - 2.5)², D + s somme des (z - mu1)²) + 10 somme des (1 - cos(2 pi (z - 2.5))) sur [-5.12, 5.12]^D. L'entonnoir contenant l'optimum global occupe un volume plus petit que l'autre.", dimension, -5.12, 5.12, 2.5)
+{
+}
+
+double LunacekSolution::function(double const * z, size_t count) const
+{
+	static constexpr double mu0{ 2.5 };
+	static constexpr double depth{ 1.0 };
+	double const n{ static_cast<double>(count) };
+	double const s{ 1.0 - 1.0 / (2.0 * std::sqrt(n + 20.0) - 8.2) };
+	double const mu1{ -std::sqrt((mu0 * mu0 - depth) / s) };
+
+	double sphere0{};
+	double sphere1{};
+	double rastrigin{};
+	for (size_t i{}; i < count; ++i) {
+		double const d0{ z[i] - mu0 };
+		double const d1{ z[i] - mu1 };
+		sphere0 += d0 * d0;
+		sphere1 += d1 * d1;
+		rastrigin += 1.0 - std::cos(twoPi * d0);
+	}
+	return std::min(sphere0, depth * n + s * sphere1) + 10.0 * rastrigin;
+}
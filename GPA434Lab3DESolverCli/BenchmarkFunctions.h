@@ -0,0 +1,102 @@
+#pragma once
+#ifndef BENCHMARK_FUNCTIONS_H
+#define BENCHMARK_FUNCTIONS_H
+
+
+#include "BenchmarkFunctionSolution.h"
+
+
+//! \file BenchmarkFunctions.h
+//! \brief Fonctions de test classiques. Toutes sont des problèmes de 
+//! minimisation de dimension quelconque dont l'optimum global vaut 0.
+
+
+//! \brief Sphère : \f$\sum z_i^2\f$, sur \f$[-100, 100]^D\f$. Unimodale et séparable.
+class SphereSolution : public BenchmarkFunctionSolution
+{
+public:
+	SphereSolution(size_t dimension = 10);
+	DEFINE_OVERRIDE_CLONE_METHOD(SphereSolution)
+protected:
+	double function(double const * z, size_t count) const override;
+};
+
+//! \brief Ellipsoïde : \f$\sum 10^{6 i / (D - 1)} z_i^2\f$, sur \f$[-100, 100]^D\f$. Unimodale, mal conditionnée (10⁶).
+class EllipsoidSolution : public BenchmarkFunctionSolution
+{
+public:
+	EllipsoidSolution(size_t dimension = 10);
+	DEFINE_OVERRIDE_CLONE_METHOD(EllipsoidSolution)
+protected:
+	double function(double const * z, size_t count) const override;
+};
+
+//! \brief Rosenbrock : \f$\sum 100 (z_{i+1} - z_i^2)^2 + (1 - z_i)^2\f$, sur \f$[-5, 10]^D\f$. Vallée courbe, optimum en \f$(1, \dots, 1)\f$.
+class RosenbrockSolution : public BenchmarkFunctionSolution
+{
+public:
+	RosenbrockSolution(size_t dimension = 10);
+	DEFINE_OVERRIDE_CLONE_METHOD(RosenbrockSolution)
+protected:
+	double function(double const * z, size_t count) const override;
+};
+
+//! \brief Rastrigin : \f$10 D + \sum z_i^2 - 10 \cos(2 \pi z_i)\f$, sur \f$[-5.12, 5.12]^D\f$. Multimodale et régulière.
+class RastriginSolution : public BenchmarkFunctionSolution
+{
+public:
+	RastriginSolution(size_t dimension = 10);
+	DEFINE_OVERRIDE_CLONE_METHOD(RastriginSolution)
+protected:
+	double function(double const * z, size_t count) const override;
+};
+
+//! \brief Ackley, sur \f$[-32.768, 32.768]^D\f$. Plateau presque plat percé d'un entonnoir central.
+class AckleySolution : public BenchmarkFunctionSolution
+{
+public:
+	AckleySolution(size_t dimension = 10);
+	DEFINE_OVERRIDE_CLONE_METHOD(AckleySolution)
+protected:
+	double function(double const * z, size_t count) const override;
+};
+
+//! \brief Griewank : \f$1 + \sum z_i^2 / 4000 - \prod \cos(z_i / \sqrt{i})\f$, sur \f$[-600, 600]^D\f$.
+class GriewankSolution : public BenchmarkFunctionSolution
+{
+public:
+	GriewankSolution(size_t dimension = 10);
+	DEFINE_OVERRIDE_CLONE_METHOD(GriewankSolution)
+protected:
+	double function(double const * z, size_t count) const override;
+};
+
+//! \brief Schwefel 2.26 : \f$418.9829 D - \sum z_i \sin(\sqrt{|z_i|})\f$, sur \f$[-500, 500]^D\f$. Optimum près des bornes, en \f$420.9687\f$.
+//!
+//! \details Déplacé ou tourné, \f$z\f$ sort de \f$[-500, 500]\f$, où la 
+//! fonction d'origine continue de descendre sous 0. Comme dans les 
+//! fonctions CEC 2014, chaque \f$|z_i| > 500\f$ est replié dans le domaine 
+//! et pénalisé de \f$(|z_i| - 500)^2 / (10^4 D)\f$ : l'optimum global 
+//! demeure le seul à valoir 0 (à l'arrondi près, soit environ 
+//! \f$10^{-13} D\f$).
+class SchwefelSolution : public BenchmarkFunctionSolution
+{
+public:
+	SchwefelSolution(size_t dimension = 10);
+	DEFINE_OVERRIDE_CLONE_METHOD(SchwefelSolution)
+protected:
+	double function(double const * z, size_t count) const override;
+};
+
+//! \brief Lunacek bi-Rastrigin, sur \f$[-5.12, 5.12]^D\f$. Deux entonnoirs, l'optimum global (en \f$\mu_0 = 2.5\f$) étant dans le plus petit.
+class LunacekSolution : public BenchmarkFunctionSolution
+{
+public:
+	LunacekSolution(size_t dimension = 10);
+	DEFINE_OVERRIDE_CLONE_METHOD(LunacekSolution)
+protected:
+	double function(double const * z, size_t count) const override;
+};
+
+
+#endif // BENCHMARK_FUNCTIONS_H
@@ -0,0 +1,181 @@
+#include "Checkpoint.h"
+
+
+#include <algorithm>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <Population.h>
+#include "SeededStrategy.h"
+#include "SolutionData.h"
+#include "InitializationFromCheckpoint.h"
+
+
+template <typename T>
+static uint64_t counterOf(T const * strategy)
+{
+	SeededStrategy const * seeded{ dynamic_cast<SeededStrategy const *>(strategy) };
+	return seeded ? seeded->generation() : Checkpoint::noCounter;
+}
+
+template <typename T>
+static T * withCounter(T * strategy, uint64_t counter)
+{
+	SeededStrategy * seeded{ dynamic_cast<SeededStrategy *>(strategy) };
+	if (seeded && counter != Checkpoint::noCounter) {
+		seeded->setGeneration(static_cast<uint32_t>(counter));
+	}
+	return strategy;
+}
+
+
+
+Checkpoint Checkpoint::capture(de::DifferentialEvolution const & engine, size_t generationOffset)
+{
+	de::Population const & population{ engine.actualPopulation() };
+	de::EngineParameters const & parameters{ engine.engineParameters() };
+	std::unique_ptr<de::MutationStrategy> const mutation{ parameters.mutationStrategy() };
+	std::unique_ptr<de::CrossoverStrategy> const crossover{ parameters.crossoverStrategy() };
+
+	Checkpoint checkpoint;
+	Header & header{ checkpoint.mHeader };
+	header.magic = sMagic;
+	header.version = version;
+	header.headerSize = sizeof(Header);
+	header.generation = generationOffset + engine.currentGeneration();
+	header.populationSize = population.size();
+	header.dimension = population.size() > 0 ? population[0].size() : 0;
+	header.mutationCounter = counterOf(mutation.get());
+	header.crossoverCounter = counterOf(crossover.get());
+	header.mutationFactor = parameters.mutationFactor();
+	header.crossoverRate = parameters.crossoverRate();
+
+	size_t const dimension{ static_cast<size_t>(header.dimension) };
+	checkpoint.mGenes.resize(population.size() * dimension);
+	checkpoint.mObjectives.resize(population.size());
+	checkpoint.mFitnesses.resize(population.size());
+	for (size_t i{}; i < population.size(); ++i) {
+		de::Solution const & solution{ population[i] };
+		std::copy_n(solutionData(solution), std::min(solution.size(), dimension), checkpoint.mGenes.begin() + i * dimension);
+		checkpoint.mObjectives[i] = solution.objective();
+		checkpoint.mFitnesses[i] = solution.fitness();
+	}
+
+	return checkpoint;
+}
+
+Checkpoint Checkpoint::load(std::filesystem::path const & path)
+{
+	std::ifstream file(path, std::ios::binary);
+	if (!file) {
+		throw std::runtime_error("Cannot open checkpoint '" + path.string() + "'.");
+	}
+
+	Checkpoint checkpoint;
+	Header & header{ checkpoint.mHeader };
+	if (!file.read(reinterpret_cast<char *>(&header), sizeof(Header)) || header.magic != sMagic) {
+		throw std::runtime_error("'" + path.string() + "' is not a checkpoint.");
+	}
+	if (header.version != version || header.headerSize != sizeof(Header)) {
+		throw std::runtime_error("Unsupported checkpoint version in '" + path.string() + "'.");
+	}
+
+	// the sizes come from the file: check them against its length before allocating anything
+	static constexpr uint64_t maxValues{ (std::min<uint64_t>(std::numeric_limits<uint64_t>::max(), std::numeric_limits<size_t>::max()) - sizeof(Header)) / sizeof(double) };
+	uint64_t const valuesPerSolution{ header.dimension + 2 };
+	if (header.dimension > maxValues - 2 || (header.populationSize > 0 && valuesPerSolution > maxValues / header.populationSize)) {
+		throw std::runtime_error("Checkpoint '" + path.string() + "' has an invalid population size or dimension.");
+	}
+	std::error_code error;
+	uintmax_t const fileSize{ std::filesystem::file_size(path, error) };
+	if (error || fileSize != header.headerSize + header.populationSize * valuesPerSolution * sizeof(double)) {
+		throw std::runtime_error("Checkpoint '" + path.string() + "' does not match the size announced by its header.");
+	}
+
+	checkpoint.mGenes.resize(static_cast<size_t>(header.populationSize * header.dimension));
+	checkpoint.mObjectives.resize(static_cast<size_t>(header.populationSize));
+	checkpoint.mFitnesses.resize(static_cast<size_t>(header.populationSize));
+	for (std::vector<double> * values : { &checkpoint.mGenes, &checkpoint.mObjectives, &checkpoint.mFitnesses }) {
+		if (!file.read(reinterpret_cast<char *>(values->data()), static_cast<std::streamsize>(values->size() * sizeof(double)))) {
+			throw std::runtime_error("Checkpoint '" + path.string() + "' is truncated.");
+		}
+	}
+
+	return checkpoint;
+}
+
+void Checkpoint::save(std::filesystem::path const & path) const
+{
+	std::filesystem::path temporary{ path };
+	temporary += ".tmp";
+
+	{
+		std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+		file.write(reinterpret_cast<char const *>(&mHeader), sizeof(Header));
+		for (std::vector<double> const * values : { &mGenes, &mObjectives, &mFitnesses }) {
+			file.write(reinterpret_cast<char const *>(values->data()), static_cast<std::streamsize>(values->size() * sizeof(double)));
+		}
+		if (!file.flush()) {
+			throw std::runtime_error("Cannot write checkpoint '" + temporary.string() + "'.");
+		}
+	}
+
+	std::error_code error;
+	std::filesystem::rename(temporary, path, error);
+	if (error) {
+		throw std::runtime_error("Cannot replace checkpoint '" + path.string() + "': " + error.message());
+	}
+}
+
+size_t Checkpoint::generation() const
+{
+	return static_cast<size_t>(mHeader.generation);
+}
+
+size_t Checkpoint::populationSize() const
+{
+	return static_cast<size_t>(mHeader.populationSize);
+}
+
+size_t Checkpoint::dimension() const
+{
+	return static_cast<size_t>(mHeader.dimension);
+}
+
+double Checkpoint::mutationFactor() const
+{
+	return mHeader.mutationFactor;
+}
+
+double Checkpoint::crossoverRate() const
+{
+	return mHeader.crossoverRate;
+}
+
+std::vector<double> const & Checkpoint::genes() const
+{
+	return mGenes;
+}
+
+std::vector<double> const & Checkpoint::objectives() const
+{
+	return mObjectives;
+}
+
+std::vector<double> const & Checkpoint::fitnesses() const
+{
+	return mFitnesses;
+}
+
+void Checkpoint::restore(de::EngineParameters & parameters) const
+{
+	parameters.setPopulationSize(populationSize());
+	parameters.setInitializationStrategy(new InitializationFromCheckpoint(std::make_shared<std::vector<double> const>(mGenes), dimension()));
+
+	// the factor and the rate belong to the strategies: set them after the strategies
+	parameters.setMutationStrategy(withCounter(parameters.mutationStrategy(), mHeader.mutationCounter));
+	parameters.setCrossoverStrategy(withCounter(parameters.crossoverStrategy(), mHeader.crossoverCounter));
+	parameters.setMutationFactor(mHeader.mutationFactor);
+	parameters.setCrossoverRate(mHeader.crossoverRate);
+}
@@ -0,0 +1,102 @@
+#pragma once
+#ifndef CHECKPOINT_H
+#define CHECKPOINT_H
+
+
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <limits>
+#include <vector>
+#include <DifferentialEvolution.h>
+#include <EngineParameters.h>
+
+
+//! \brief Point de reprise binaire d'une simulation `de::DifferentialEvolution`.
+//!
+//! \details L'état interne de l'engin (historique, populations de mutants 
+//! et d'essais) appartient à `delib` et ne peut pas être réécrit de 
+//! l'extérieur. Le point de reprise conserve ce qui détermine la suite de 
+//! l'évolution :
+//!  - la génération atteinte;
+//!  - la population courante (gènes, valeurs objectives et « fitness »), 
+//!    triée de la meilleure à la pire solution;
+//!  - les facteurs F et CR;
+//!  - les compteurs des stratégies de mutation et de croisement héritant de 
+//!    SeededStrategy.
+//!
+//! La reprise (voir restore) réinjecte la population par 
+//! InitializationFromCheckpoint et replace les compteurs. Avec des 
+//! stratégies reproductibles, la suite de l'évolution est identique à 
+//! celle d'une simulation ininterrompue; seul l'historique repart de la 
+//! génération reprise. La population est réévaluée à la reprise (N 
+//! évaluations).
+//!
+//! Le fichier est formé d'un en-tête de 128 octets suivi de trois tableaux 
+//! contigus de `double` en ordre natif : les gènes (N × D, par rangée), les 
+//! valeurs objectives (N) puis les « fitness » (N). Tous les décalages sont 
+//! fixes et alignés sur 8 octets : le fichier peut être projeté en mémoire 
+//! tel quel. Il n'est portable qu'entre machines de même boutisme.
+class Checkpoint
+{
+public:
+	static constexpr uint32_t version{ 1 };								//!< Version du format de fichier.
+	static constexpr uint64_t noCounter{ std::numeric_limits<uint64_t>::max() }; //!< Compteur absent (la stratégie n'hérite pas de SeededStrategy).
+
+	//! \brief En-tête du fichier. Sa taille est fixe (128 octets).
+	struct Header
+	{
+		std::array<char, 8> magic;										//!< Signature « DECKPT » suivie de deux octets nuls.
+		uint32_t version;												//!< Version du format.
+		uint32_t headerSize;											//!< Taille de l'en-tête, soit le décalage des gènes.
+		uint64_t generation;											//!< Génération atteinte.
+		uint64_t populationSize;										//!< Taille de la population (N).
+		uint64_t dimension;												//!< Dimension des solutions (D).
+		uint64_t mutationCounter;										//!< Compteur de la stratégie de mutation ou noCounter.
+		uint64_t crossoverCounter;										//!< Compteur de la stratégie de croisement ou noCounter.
+		double mutationFactor;											//!< Facteur de mutation F.
+		double crossoverRate;											//!< Taux de croisement CR.
+		std::array<uint64_t, 7> reserved;								//!< Réservé pour les versions futures (zéros).
+	};
+
+	Checkpoint() = default;												//!< Constructeur par défaut (point de reprise vide).
+
+	//! \brief Capture l'état d'un engin. `generationOffset` est ajouté à la 
+	//! génération de l'engin (simulation elle-même reprise d'un point de 
+	//! reprise).
+	static Checkpoint capture(de::DifferentialEvolution const & engine, size_t generationOffset = 0);
+	//! \brief Lit un point de reprise. Lance `std::runtime_error` si le fichier est illisible ou invalide.
+	static Checkpoint load(std::filesystem::path const & path);
+	//! \brief Écrit le point de reprise. Le fichier est d'abord écrit sous un 
+	//! nom temporaire puis renommé : une interruption ne laisse jamais un 
+	//! fichier partiel. Lance `std::runtime_error` en cas d'échec.
+	void save(std::filesystem::path const & path) const;
+
+	size_t generation() const;											//!< Retourne la génération atteinte.
+	size_t populationSize() const;										//!< Retourne la taille de la population.
+	size_t dimension() const;											//!< Retourne la dimension des solutions.
+	double mutationFactor() const;										//!< Retourne le facteur de mutation F.
+	double crossoverRate() const;										//!< Retourne le taux de croisement CR.
+	std::vector<double> const & genes() const;							//!< Retourne les gènes de la population (N × D, par rangée).
+	std::vector<double> const & objectives() const;						//!< Retourne les valeurs objectives.
+	std::vector<double> const & fitnesses() const;						//!< Retourne les valeurs de « fitness ».
+
+	//! \brief Prépare des paramètres pour reprendre la simulation : taille de 
+	//! population, initialisation par InitializationFromCheckpoint, F, CR et 
+	//! compteurs des stratégies reproductibles. Le nombre de générations 
+	//! maximum n'est pas modifié.
+	void restore(de::EngineParameters & parameters) const;
+
+private:
+	Header mHeader{};
+	std::vector<double> mGenes;
+	std::vector<double> mObjectives;
+	std::vector<double> mFitnesses;
+
+	static constexpr std::array<char, 8> sMagic{ 'D', 'E', 'C', 'K', 'P', 'T', '\0', '\0' };
+};
+
+static_assert(sizeof(Checkpoint::Header) == 128, "The checkpoint header must keep its fixed size.");
+
+
+#endif // CHECKPOINT_H
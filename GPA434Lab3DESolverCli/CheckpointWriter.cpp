@@ -0,0 +1,90 @@
+#include "CheckpointWriter.h"
+
+
+#include <utility>
+
+
+CheckpointWriter::CheckpointWriter(std::filesystem::path path)
+	: mPath(std::move(path))
+	, mThread(&CheckpointWriter::run, this)
+{
+}
+
+CheckpointWriter::~CheckpointWriter()
+{
+	stop();
+}
+
+std::filesystem::path const & CheckpointWriter::path() const
+{
+	return mPath;
+}
+
+size_t CheckpointWriter::writtenCount() const
+{
+	std::scoped_lock const lock(mMutex);
+	return mWrittenCount;
+}
+
+void CheckpointWriter::submit(Checkpoint checkpoint)
+{
+	{
+		std::scoped_lock const lock(mMutex);
+		mPending = std::move(checkpoint);
+	}
+	mCondition.notify_one();
+}
+
+void CheckpointWriter::finish()
+{
+	stop();
+
+	std::scoped_lock const lock(mMutex);
+	if (mError) {
+		std::rethrow_exception(std::exchange(mError, nullptr));
+	}
+}
+
+void CheckpointWriter::stop()
+{
+	{
+		std::scoped_lock const lock(mMutex);
+		mStopping = true;
+	}
+	mCondition.notify_one();
+	if (mThread.joinable()) {
+		mThread.join();
+	}
+}
+
+void CheckpointWriter::run()
+{
+	std::unique_lock lock(mMutex);
+	while (true) {
+		mCondition.wait(lock, [this] { return mPending.has_value() || mStopping; });
+		if (!mPending) {
+			return;
+		}
+
+		Checkpoint const checkpoint{ std::move(*mPending) };
+		mPending.reset();
+
+		// the disk is slow: let the evolution submit the next checkpoint meanwhile
+		lock.unlock();
+		std::exception_ptr error;
+		try {
+			checkpoint.save(mPath);
+		} catch (...) {
+			error = std::current_exception();
+		}
+		lock.lock();
+
+		if (error) {
+			if (!mError) {
+				mError = error;
+			}
+		} else {
+			++mWrittenCount;
+		}
+	}
+}
@@ -0,0 +1,57 @@
+#pragma once
+#ifndef CHECKPOINT_WRITER_H
+#define CHECKPOINT_WRITER_H
+
+
+#include <condition_variable>
+#include <exception>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include "Checkpoint.h"
+
+
+//! \brief Écrit les points de reprise sur un fil d'exécution dédié.
+//!
+//! \details La boucle d'évolution ne fait que capturer la population 
+//! (Checkpoint::capture) et la remettre à l'écrivain avec submit; 
+//! l'écriture sur disque se fait en arrière-plan. Un seul point de reprise 
+//! est en attente à la fois : si le disque est plus lent que l'évolution, 
+//! le plus récent remplace celui qui n'a pas encore été écrit.
+//!
+//! Une erreur d'écriture est conservée et relancée par finish.
+class CheckpointWriter
+{
+public:
+	CheckpointWriter(std::filesystem::path path);						//!< Constructeur. Démarre le fil d'écriture.
+	CheckpointWriter(CheckpointWriter const &) = delete;
+	CheckpointWriter(CheckpointWriter &&) = delete;
+	CheckpointWriter& operator=(CheckpointWriter const &) = delete;
+	CheckpointWriter& operator=(CheckpointWriter &&) = delete;
+	~CheckpointWriter();												//!< Destructeur. Écrit le point de reprise en attente puis arrête le fil (les erreurs sont ignorées).
+
+	std::filesystem::path const & path() const;							//!< Retourne le chemin du fichier.
+	size_t writtenCount() const;										//!< Retourne le nombre de points de reprise écrits.
+
+	void submit(Checkpoint checkpoint);									//!< Remet un point de reprise à écrire. Ne bloque pas pendant l'écriture.
+	//! \brief Écrit le point de reprise en attente, arrête le fil puis relance 
+	//! la première erreur d'écriture survenue, s'il y a lieu.
+	void finish();
+
+private:
+	std::filesystem::path mPath;
+	mutable std::mutex mMutex;
+	std::condition_variable mCondition;
+	std::optional<Checkpoint> mPending;
+	bool mStopping{};
+	size_t mWrittenCount{};
+	std::exception_ptr mError;
+	std::thread mThread;
+
+	void run();
+	void stop();
+};
+
+
+#endif // CHECKPOINT_WRITER_H
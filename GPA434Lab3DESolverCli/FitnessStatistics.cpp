@@ -0,0 +1,141 @@
+#include "FitnessStatistics.h"
+
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <vector>
+#include <Population.h>
+
+
+FitnessStatistics FitnessStatistics::of(double const * values, size_t count)
+{
+	FitnessStatistics result;
+
+	for (size_t start{}; start < count; start += sBlockSize) {
+		size_t const blockCount{ std::min(sBlockSize, count - start) };
+		double const * block{ values + start };
+		size_t const laneEnd{ blockCount - blockCount % sLaneCount };
+
+		// independent lanes: no loop-carried dependency between consecutive values
+		std::array<double, sLaneCount> minimum, maximum, sum{};
+		minimum.fill(block[0]);
+		maximum.fill(block[0]);
+		for (size_t i{}; i < laneEnd; i += sLaneCount) {
+			for (size_t l{}; l < sLaneCount; ++l) {
+				double const value{ block[i + l] };
+				minimum[l] = value < minimum[l] ? value : minimum[l];
+				maximum[l] = value > maximum[l] ? value : maximum[l];
+				sum[l] += value;
+			}
+		}
+		for (size_t i{ laneEnd }; i < blockCount; ++i) {
+			minimum[0] = std::min(minimum[0], block[i]);
+			maximum[0] = std::max(maximum[0], block[i]);
+			sum[0] += block[i];
+		}
+
+		FitnessStatistics partial;
+		partial.mCount = blockCount;
+		partial.mMinimum = *std::min_element(minimum.begin(), minimum.end());
+		partial.mMaximum = *std::max_element(maximum.begin(), maximum.end());
+		partial.mMean = ((sum[0] + sum[1]) + (sum[2] + sum[3])) / static_cast<double>(blockCount);
+
+		// second sweep of the block, still in cache: deviations from the block mean
+		std::array<double, sLaneCount> m2{};
+		for (size_t i{}; i < laneEnd; i += sLaneCount) {
+			for (size_t l{}; l < sLaneCount; ++l) {
+				double const delta{ block[i + l] - partial.mMean };
+				m2[l] += delta * delta;
+			}
+		}
+		for (size_t i{ laneEnd }; i < blockCount; ++i) {
+			double const delta{ block[i] - partial.mMean };
+			m2[0] += delta * delta;
+		}
+		partial.mM2 = (m2[0] + m2[1]) + (m2[2] + m2[3]);
+
+		result.merge(partial);
+	}
+
+	return result;
+}
+
+FitnessStatistics FitnessStatistics::of(de::Population const & population)
+{
+	std::vector<double> fitness(population.size());
+	for (size_t i{}; i < population.size(); ++i) {
+		fitness[i] = population[i].fitness();
+	}
+	return of(fitness.data(), fitness.size());
+}
+
+void FitnessStatistics::add(double value)
+{
+	if (mCount == 0) {
+		mMinimum = value;
+		mMaximum = value;
+	} else {
+		mMinimum = std::min(mMinimum, value);
+		mMaximum = std::max(mMaximum, value);
+	}
+
+	++mCount;
+	double const delta{ value - mMean };
+	mMean += delta / static_cast<double>(mCount);
+	mM2 += delta * (value - mMean);
+}
+
+void FitnessStatistics::merge(FitnessStatistics const & other)
+{
+	if (other.mCount == 0) {
+		return;
+	}
+	if (mCount == 0) {
+		*this = other;
+		return;
+	}
+
+	double const count{ static_cast<double>(mCount + other.mCount) };
+	double const delta{ other.mMean - mMean };
+	mMean += delta * (static_cast<double>(other.mCount) / count);
+	mM2 += other.mM2 + delta * delta * (static_cast<double>(mCount) * static_cast<double>(other.mCount) / count);
+	mMinimum = std::min(mMinimum, other.mMinimum);
+	mMaximum = std::max(mMaximum, other.mMaximum);
+	mCount += other.mCount;
+}
+
+size_t FitnessStatistics::count() const
+{
+	return mCount;
+}
+
+double FitnessStatistics::minimum() const
+{
+	return mMinimum;
+}
+
+double FitnessStatistics::maximum() const
+{
+	return mMaximum;
+}
+
+double FitnessStatistics::sum() const
+{
+	return mMean * static_cast<double>(mCount);
+}
+
+double FitnessStatistics::average() const
+{
+	return mMean;
+}
+
+double FitnessStatistics::variance() const
+{
+	return mCount > 0 ? mM2 / static_cast<double>(mCount) : 0.0;
+}
+
+double FitnessStatistics::stdev() const
+{
+	return std::sqrt(variance());
+}
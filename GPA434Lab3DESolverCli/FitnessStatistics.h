@@ -0,0 +1,61 @@
+#pragma once
+#ifndef FITNESS_STATISTICS_H
+#define FITNESS_STATISTICS_H
+
+
+#include <cstddef>
+
+
+namespace de { class Population; }
+
+
+//! \brief Statistiques d'un ensemble de valeurs de « fitness », stables 
+//! numériquement et combinables.
+//!
+//! \details `de::Statistics` accumule la somme et la somme des carrés 
+//! (approche naïve) : l'écart type perd toute précision lorsque les 
+//! valeurs sont grandes par rapport à leur dispersion (par exemple 
+//! \f$10^9 \pm 1\f$). FitnessStatistics conserve plutôt le nombre, la 
+//! moyenne et la somme des carrés des écarts à la moyenne 
+//! (\f$M_2\f$) :
+//!  - add ajoute une valeur selon l'algorithme de Welford;
+//!  - merge combine deux ensembles selon la formule de Chan et al., ce qui 
+//!    permet de calculer les statistiques par fil d'exécution ou par île 
+//!    puis de les réunir;
+//!  - of parcourt un tableau contigu par blocs de 256 valeurs. Chaque bloc 
+//!    est réduit avec quatre accumulateurs indépendants (minimum, maximum 
+//!    et somme, puis écarts à la moyenne du bloc encore en cache), une 
+//!    forme que le compilateur vectorise; les blocs sont ensuite combinés 
+//!    par merge. Le tableau n'est lu qu'une fois depuis la mémoire.
+class FitnessStatistics
+{
+public:
+	FitnessStatistics() = default;										//!< Constructeur par défaut (ensemble vide).
+
+	static FitnessStatistics of(double const * values, size_t count);	//!< Calcule les statistiques d'un tableau contigu.
+	static FitnessStatistics of(de::Population const & population);		//!< Calcule les statistiques des « fitness » d'une population.
+
+	void add(double value);												//!< Ajoute une valeur.
+	void merge(FitnessStatistics const & other);						//!< Ajoute toutes les valeurs d'un autre ensemble.
+
+	size_t count() const;												//!< Retourne le nombre de valeurs.
+	double minimum() const;												//!< Retourne la plus petite valeur (0 si vide).
+	double maximum() const;												//!< Retourne la plus grande valeur (0 si vide).
+	double sum() const;													//!< Retourne la somme des valeurs.
+	double average() const;												//!< Retourne la moyenne (0 si vide).
+	double variance() const;											//!< Retourne la variance de la population de valeurs (0 si vide).
+	double stdev() const;												//!< Retourne l'écart type de la population de valeurs (0 si vide).
+
+private:
+	size_t mCount{};
+	double mMean{};
+	double mM2{};
+	double mMinimum{};
+	double mMaximum{};
+
+	static constexpr size_t sBlockSize{ 256 };
+	static constexpr size_t sLaneCount{ 4 };
+};
+
+
+#endif // FITNESS_STATISTICS_H
@@ -0,0 +1,163 @@
+#include "HeadlessRunner.h"
+
+
+#include <algorithm>
+#include <stdexcept>
+#include <DifferentialEvolution.h>
+#include "IslandDifferentialEvolution.h"
+#include "SteadyStateDifferentialEvolution.h"
+#include "Checkpoint.h"
+#include "CheckpointWriter.h"
+
+
+RunResult HeadlessRunner::run(RunnerOptions const & options)
+{
+	if (options.islandCount > 1) {
+		return runIslands(options);
+	}
+	if (options.asyncWorkerCount) {
+		return runSteadyState(options);
+	}
+
+	std::unique_ptr<de::SolutionStrategy> solution{ options.buildSolution() };
+	de::EngineParameters parameters{ options.buildEngineParameters(*solution) };
+
+	size_t generationOffset{};
+	if (options.resumePath) {
+		Checkpoint const checkpoint{ Checkpoint::load(*options.resumePath) };
+		if (checkpoint.dimension() != solution->domain().size()) {
+			throw std::invalid_argument("The checkpoint does not match the problem dimension.");
+		}
+		checkpoint.restore(parameters);
+		// the engine counts from zero again: only the remaining generations are left to do
+		generationOffset = checkpoint.generation();
+		size_t const maximum{ parameters.maximumGeneration() };
+		parameters.setMaxGeneration(maximum > generationOffset ? maximum - generationOffset : 0);
+	}
+
+	RunResult result;
+	result.problem = solution->name();
+
+	de::DifferentialEvolution de;
+	if (de.setup(solution.release()) != de::DifferentialEvolution::SetupState::Success) {
+		throw std::invalid_argument("The problem could not be set up.");
+	}
+	// the solution imposes its own parameters during setup: apply ours afterward
+	de.setEngineParameters(parameters);
+	if (!de.isReady()) {
+		throw std::invalid_argument("The engine parameters are invalid.");
+	}
+
+	size_t const initialGeneration{ de.currentGeneration() };
+	GenerationStopwatch stopwatch;
+	if (options.checkpointPath) {
+		CheckpointWriter writer(*options.checkpointPath);
+		while (!de.isStoppingCriteriaReached()) {
+			de.processToNextGeneration();
+			if ((generationOffset + de.currentGeneration()) % options.checkpointInterval == 0) {
+				writer.submit(Checkpoint::capture(de, generationOffset));
+			}
+		}
+		writer.submit(Checkpoint::capture(de, generationOffset));
+		writer.finish();
+	} else {
+		de.process();
+	}
+	size_t const generationCount{ de.currentGeneration() - initialGeneration };
+	result.timing = stopwatch.elapsed(generationCount * de.actualPopulation().size(), generationCount);
+
+	result.populationSize = de.actualPopulation().size();
+	result.generationCount = generationOffset + de.currentGeneration();
+	result.bestObjective = de.actualPopulation()[0].objective();
+	result.bestFitness = de.actualPopulation()[0].fitness();
+	result.bestSolutionInfo = de.bestSolutionInfo();
+	result.fitnessStatistics = FitnessStatistics::of(de.actualPopulation());
+
+	return result;
+}
+
+RunResult HeadlessRunner::runIslands(RunnerOptions const & options)
+{
+	std::unique_ptr<de::SolutionStrategy> solution{ options.buildSolution() };
+
+	RunResult result;
+	result.problem = solution->name();
+	result.islandCount = options.islandCount;
+
+	IslandDifferentialEvolution islands;
+	islands.setMigrationParameters(options.migration);
+	for (size_t k{}; k < options.islandCount; ++k) {
+		// same problem everywhere, but a distinct seed for each island's strategies
+		RunnerOptions islandOptions{ options };
+		islandOptions.seed = options.seed + k;
+		islands.addIsland(static_cast<de::SolutionStrategy *>(solution->clone()), islandOptions.buildEngineParameters(*solution));
+	}
+
+	std::vector<size_t> initialGenerations(islands.islandCount());
+	for (size_t k{}; k < islands.islandCount(); ++k) {
+		initialGenerations[k] = islands.island(k).currentGeneration();
+	}
+	GenerationStopwatch stopwatch;
+	islands.process();
+	size_t generationCount{};
+	size_t evaluationCount{};
+	for (size_t k{}; k < islands.islandCount(); ++k) {
+		de::DifferentialEvolution const & island{ islands.island(k) };
+		size_t const generations{ island.currentGeneration() - initialGenerations[k] };
+		generationCount = std::max(generationCount, generations);
+		evaluationCount += generations * island.actualPopulation().size();
+	}
+	result.timing = stopwatch.elapsed(evaluationCount, generationCount);
+	result.parallelIslands = islands.isParallel();
+	result.migrationCount = islands.migrationCount();
+
+	de::DifferentialEvolution const & best{ islands.island(islands.bestIsland(*options.buildOptimization(*solution))) };
+	result.populationSize = best.actualPopulation().size();
+	result.generationCount = best.currentGeneration();
+	result.bestObjective = best.actualPopulation()[0].objective();
+	result.bestFitness = best.actualPopulation()[0].fitness();
+	result.bestSolutionInfo = best.bestSolutionInfo();
+	result.fitnessStatistics = islands.statistics();
+
+	return result;
+}
+
+RunResult HeadlessRunner::runSteadyState(RunnerOptions const & options)
+{
+	std::unique_ptr<de::SolutionStrategy> solution{ options.buildSolution() };
+	BenchmarkFunctionSolution const * problem{ dynamic_cast<BenchmarkFunctionSolution const *>(solution.get()) };
+	if (!problem) {
+		throw std::invalid_argument("Option --async requires a benchmark function problem.");
+	}
+	de::EngineParameters const parameters{ options.buildEngineParameters(*solution) };
+
+	SteadyStateDifferentialEvolution::Parameters steadyState;
+	steadyState.populationSize = parameters.populationSize();
+	steadyState.evaluationCount = parameters.populationSize() * parameters.maximumGeneration();
+	steadyState.mutationFactor = parameters.mutationFactor();
+	steadyState.crossoverRate = parameters.crossoverRate();
+	steadyState.workerCount = *options.asyncWorkerCount;
+	steadyState.seed = options.seed;
+
+	SteadyStateDifferentialEvolution de(*problem, steadyState);
+
+	RunResult result;
+	result.problem = problem->name();
+	result.asyncWorkerCount = de.workerCount();
+
+	GenerationStopwatch stopwatch;
+	de.process();
+	size_t const evaluationCount{ de.evaluationCount() };
+	result.timing = stopwatch.elapsed(evaluationCount, evaluationCount / steadyState.populationSize);
+
+	result.populationSize = steadyState.populationSize;
+	result.generationCount = evaluationCount / steadyState.populationSize;
+	result.replacementCount = de.replacementCount();
+	result.bestObjective = de.bestObjective();
+	// the fitness strategy of the benchmark functions is the identity
+	result.bestFitness = result.bestObjective;
+	result.bestSolutionInfo = de.bestSolutionInfo();
+	result.fitnessStatistics = de.statistics();
+
+	return result;
+}
@@ -0,0 +1,58 @@
+#pragma once
+#ifndef HEADLESS_RUNNER_H
+#define HEADLESS_RUNNER_H
+
+
+#include <string>
+#include "RunnerOptions.h"
+#include "GenerationTiming.h"
+#include "FitnessStatistics.h"
+
+
+//! \brief Résultat d'une simulation exécutée sans interface graphique.
+struct RunResult
+{
+	std::string problem;												//!< Nom du problème résolu.
+	size_t populationSize{};											//!< Taille de la population utilisée.
+	size_t generationCount{};											//!< Nombre de générations effectuées.
+	double bestObjective{};												//!< Valeur objective de la meilleure solution.
+	double bestFitness{};												//!< Valeur de « fitness » de la meilleure solution.
+	std::string bestSolutionInfo;										//!< Représentation textuelle de la meilleure solution.
+	FitnessStatistics fitnessStatistics;								//!< Statistiques des « fitness » de la population finale (de toutes les îles).
+	GenerationTiming timing;											//!< Temps cumulé de l'évolution (l'initialisation est exclue).
+	size_t islandCount{ 1 };											//!< Nombre d'îles.
+	bool parallelIslands{};												//!< Indique si les îles se sont exécutées en parallèle.
+	size_t migrationCount{};											//!< Nombre total de migrants envoyés.
+	size_t asyncWorkerCount{};											//!< Nombre de fils de l'évolution asynchrone (0 : évolution par générations).
+	size_t replacementCount{};											//!< Nombre d'essais ayant remplacé leur cible (évolution asynchrone).
+};
+
+
+//! \brief Exécute une simulation complète de `de::DifferentialEvolution` 
+//! sans `Qt`.
+//!
+//! \details La configuration reproduit celle de l'application : le 
+//! problème est d'abord donné à `setup`, puis les paramètres sont appliqués. 
+//! L'évolution est ensuite lancée d'un trait avec `process()` jusqu'à ce 
+//! qu'un critère d'arrêt soit atteint.
+//!
+//! Avec plusieurs îles, l'évolution est confiée à 
+//! IslandDifferentialEvolution et le résultat décrit l'île possédant la 
+//! meilleure solution. Avec `--async`, l'évolution est confiée à 
+//! SteadyStateDifferentialEvolution; une génération y équivaut à N 
+//! évaluations.
+class HeadlessRunner
+{
+public:
+	//! \brief Lance la simulation décrite par les options. Lance 
+	//! `std::invalid_argument` si les options ne permettent pas de configurer 
+	//! l'engin.
+	static RunResult run(RunnerOptions const & options);
+
+private:
+	static RunResult runIslands(RunnerOptions const & options);
+	static RunResult runSteadyState(RunnerOptions const & options);
+};
+
+
+#endif // HEADLESS_RUNNER_H
@@ -0,0 +1,38 @@
+#include "InitializationFromCheckpoint.h"
+
+
+#include <algorithm>
+#include <SolutionStrategy.h>
+#include <Population.h>
+#include "SolutionData.h"
+
+
+static const std::string ifc_title("Point de reprise");
+static const std::string ifc_summary("Initialisation à partir d'une population sauvegardée.");
+static const std::string ifc_description("Chaque solution reçoit les gènes sauvegardés par un point de reprise. Les solutions en surplus sont initialisées uniformément dans le domaine.");
+
+
+InitializationFromCheckpoint::InitializationFromCheckpoint(std::shared_ptr<std::vector<double> const> genes, size_t dimension)
+	: InitializationStrategy(ifc_title, ifc_summary, ifc_description)
+	, mGenes(std::move(genes))
+	, mDimension{ dimension }
+{
+}
+
+void InitializationFromCheckpoint::process(de::SolutionStrategy const & solutionStrategy, de::Population & actualPopulation)
+{
+	size_t const savedCount{ mGenes && mDimension > 0 ? mGenes->size() / mDimension : 0 };
+
+	for (size_t i{}; i < actualPopulation.size(); ++i) {
+		de::Solution & solution{ actualPopulation[i] };
+		if (i < savedCount) {
+			std::copy_n(mGenes->begin() + i * mDimension, std::min(solution.size(), mDimension), solutionData(solution));
+		} else {
+			de::SolutionDomain const & domain{ solutionStrategy.domain() };
+			double * genes{ solutionData(solution) };
+			for (size_t j{}; j < std::min(solution.size(), domain.size()); ++j) {
+				genes[j] = domain[j].generate();
+			}
+		}
+	}
+}
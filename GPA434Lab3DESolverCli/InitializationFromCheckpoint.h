@@ -0,0 +1,39 @@
+#pragma once
+#ifndef INITIALIZATION_FROM_CHECKPOINT_H
+#define INITIALIZATION_FROM_CHECKPOINT_H
+
+
+#include <memory>
+#include <vector>
+#include <InitializationStrategy.h>
+
+
+//! \brief Stratégie d'initialisation recopiant une population sauvegardée.
+//!
+//! \details Utilisée par Checkpoint::restore pour reprendre une simulation. 
+//! La solution _i_ reçoit la rangée _i_ des gènes sauvegardés. Les 
+//! solutions sans rangée correspondante (population agrandie) sont 
+//! initialisées uniformément dans le domaine par le problème. Les gènes 
+//! sont partagés entre les copies de la stratégie plutôt que recopiés à 
+//! chaque clonage.
+class InitializationFromCheckpoint : public de::InitializationStrategy
+{
+public:
+	InitializationFromCheckpoint(std::shared_ptr<std::vector<double> const> genes, size_t dimension); //!< Constructeur avec les gènes (N × D, par rangée) et la dimension D.
+	InitializationFromCheckpoint(InitializationFromCheckpoint const &) = default;				//!< Constructeur de copie.
+	InitializationFromCheckpoint(InitializationFromCheckpoint &&) = default;					//!< Constructeur de déplacement.
+	InitializationFromCheckpoint& operator=(InitializationFromCheckpoint const &) = default;		//!< Opérateur d'assignation de copie.
+	InitializationFromCheckpoint& operator=(InitializationFromCheckpoint &&) = default;			//!< Opérateur d'assignation de déplacement.
+	~InitializationFromCheckpoint() override = default;											//!< Destructeur.
+
+	void process(de::SolutionStrategy const & solutionStrategy, de::Population & actualPopulation) override; //!< Recopie les gènes sauvegardés dans la population.
+
+	DEFINE_OVERRIDE_CLONE_METHOD(InitializationFromCheckpoint)									//!< Macro définissant automatiquement la substitution de la méthode de clonage.
+
+private:
+	std::shared_ptr<std::vector<double> const> mGenes;
+	size_t mDimension;
+};
+
+
+#endif // INITIALIZATION_FROM_CHECKPOINT_H
@@ -0,0 +1,239 @@
+#include "IslandDifferentialEvolution.h"
+
+
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+#include <thread>
+#include <Population.h>
+#include "SeededStrategy.h"
+#include "SolutionData.h"
+
+
+IslandDifferentialEvolution::MigrationParameters const & IslandDifferentialEvolution::migrationParameters() const
+{
+	return mParameters;
+}
+
+void IslandDifferentialEvolution::setMigrationParameters(MigrationParameters const & parameters)
+{
+	if (!mIslands.empty()) {
+		throw std::invalid_argument("IslandDifferentialEvolution: the migration parameters must be set before adding islands.");
+	}
+	if (parameters.interval == 0) {
+		throw std::invalid_argument("IslandDifferentialEvolution: the migration interval must be positive.");
+	}
+	mParameters = parameters;
+}
+
+void IslandDifferentialEvolution::addIsland(de::SolutionStrategy * solutionStrategy, de::EngineParameters const & parameters)
+{
+	std::unique_ptr<Island> island{ std::make_unique<Island>() };
+	island->inbox = std::make_shared<MigrationCrossover::Inbox>();
+
+	if (island->engine.setup(solutionStrategy) != de::DifferentialEvolution::SetupState::Success) {
+		throw std::invalid_argument("IslandDifferentialEvolution: the island problem could not be set up.");
+	}
+
+	de::EngineParameters islandParameters{ parameters };
+	std::unique_ptr<de::InitializationStrategy> const initialization{ islandParameters.initializationStrategy() };
+	std::unique_ptr<de::MutationStrategy> const mutation{ islandParameters.mutationStrategy() };
+	std::unique_ptr<de::CrossoverStrategy> crossover{ islandParameters.crossoverStrategy() };
+	if (!crossover) {
+		throw std::invalid_argument("IslandDifferentialEvolution: each island needs a crossover strategy.");
+	}
+	// delib's strategies share static random engines: only seeded strategies may run concurrently
+	// (the initialization too, since delib may run it inside processToNextGeneration or reset)
+	island->seeded = dynamic_cast<SeededStrategy *>(initialization.get()) && dynamic_cast<SeededStrategy *>(mutation.get()) && dynamic_cast<SeededStrategy *>(crossover.get());
+
+	uint64_t const seed{ mParameters.seed ^ (0x9E3779B97F4A7C15ull * (mIslands.size() + 1)) };
+	islandParameters.setCrossoverStrategy(new MigrationCrossover(crossover.release(), island->inbox, mParameters.replacement, seed));
+	island->engine.setEngineParameters(islandParameters);
+	if (!island->engine.isReady()) {
+		throw std::invalid_argument("IslandDifferentialEvolution: the island engine parameters are invalid.");
+	}
+
+	mIslands.push_back(std::move(island));
+}
+
+size_t IslandDifferentialEvolution::islandCount() const
+{
+	return mIslands.size();
+}
+
+de::DifferentialEvolution const & IslandDifferentialEvolution::island(size_t index) const
+{
+	return mIslands.at(index)->engine;
+}
+
+bool IslandDifferentialEvolution::isParallel() const
+{
+	return mIslands.size() > 1 && std::all_of(mIslands.begin(), mIslands.end(), [](std::unique_ptr<Island> const & island) { return island->seeded; });
+}
+
+size_t IslandDifferentialEvolution::epoch() const
+{
+	return mEpoch;
+}
+
+size_t IslandDifferentialEvolution::migrationCount() const
+{
+	return mMigrationCount;
+}
+
+bool IslandDifferentialEvolution::isStoppingCriteriaReached() const
+{
+	return std::all_of(mIslands.begin(), mIslands.end(), [](std::unique_ptr<Island> const & island) { return island->engine.isStoppingCriteriaReached(); });
+}
+
+void IslandDifferentialEvolution::processEpoch()
+{
+	if (mIslands.empty() || isStoppingCriteriaReached()) {
+		return;
+	}
+
+	size_t const interval{ mParameters.interval };
+	auto evolve{ [interval](de::DifferentialEvolution & engine) {
+		for (size_t g{}; g < interval && !engine.isStoppingCriteriaReached(); ++g) {
+			engine.processToNextGeneration();
+		}
+	} };
+
+	if (isParallel()) {
+		std::vector<std::exception_ptr> errors(mIslands.size());
+		{
+			std::vector<std::jthread> threads;
+			threads.reserve(mIslands.size() - 1);
+			for (size_t i{ 1 }; i < mIslands.size(); ++i) {
+				threads.emplace_back([&, i] {
+					try {
+						evolve(mIslands[i]->engine);
+					} catch (...) {
+						errors[i] = std::current_exception();
+					}
+				});
+			}
+			// the calling thread evolves the first island
+			try {
+				evolve(mIslands[0]->engine);
+			} catch (...) {
+				errors[0] = std::current_exception();
+			}
+		}
+		for (std::exception_ptr const & error : errors) {
+			if (error) {
+				std::rethrow_exception(error);
+			}
+		}
+	} else {
+		for (std::unique_ptr<Island> & island : mIslands) {
+			evolve(island->engine);
+		}
+	}
+
+	++mEpoch;
+	migrate();
+}
+
+void IslandDifferentialEvolution::process()
+{
+	while (!mIslands.empty() && !isStoppingCriteriaReached()) {
+		processEpoch();
+	}
+}
+
+size_t IslandDifferentialEvolution::bestIsland(de::OptimizationStrategy const & optimization) const
+{
+	if (mIslands.empty()) {
+		throw std::logic_error("IslandDifferentialEvolution: there is no island.");
+	}
+
+	size_t best{};
+	for (size_t i{ 1 }; i < mIslands.size(); ++i) {
+		double const candidate{ mIslands[i]->engine.actualPopulation()[0].fitness() };
+		double const current{ mIslands[best]->engine.actualPopulation()[0].fitness() };
+		if (optimization.compare(candidate, current)) {
+			best = i;
+		}
+	}
+	return best;
+}
+
+FitnessStatistics IslandDifferentialEvolution::statistics() const
+{
+	FitnessStatistics statistics;
+	for (std::unique_ptr<Island> const & island : mIslands) {
+		statistics.merge(FitnessStatistics::of(island->engine.actualPopulation()));
+	}
+	return statistics;
+}
+
+std::vector<size_t> IslandDifferentialEvolution::destinationsOf(size_t index, CounterBasedRandom const & random) const
+{
+	size_t const count{ mIslands.size() };
+	std::vector<size_t> destinations;
+
+	switch (mParameters.topology) {
+	case Topology::Ring:
+		destinations.push_back((index + 1) % count);
+		break;
+	case Topology::Torus: {
+		// the most square grid: rows is the largest divisor not above the square root
+		size_t rows{ 1 };
+		for (size_t r{ 1 }; r * r <= count; ++r) {
+			if (count % r == 0) {
+				rows = r;
+			}
+		}
+		size_t const columns{ count / rows };
+		size_t const row{ index / columns };
+		size_t const column{ index % columns };
+		destinations.push_back(row * columns + (column + 1) % columns);
+		destinations.push_back(((row + 1) % rows) * columns + column);
+		break;
+	}
+	case Topology::FullyConnected:
+		for (size_t i{}; i < count; ++i) {
+			destinations.push_back(i);
+		}
+		break;
+	case Topology::Random: {
+		size_t const destination{ random.index(count - 1, static_cast<uint32_t>(mEpoch), sTopologyStream, static_cast<uint32_t>(index), 0) };
+		destinations.push_back(destination >= index ? destination + 1 : destination);
+		break;
+	}
+	}
+
+	std::sort(destinations.begin(), destinations.end());
+	destinations.erase(std::unique(destinations.begin(), destinations.end()), destinations.end());
+	std::erase(destinations, index);
+	return destinations;
+}
+
+void IslandDifferentialEvolution::migrate()
+{
+	if (mIslands.size() < 2 || mParameters.migrantCount == 0) {
+		return;
+	}
+
+	// every island emigrates from the populations of this epoch, before any arrival
+	std::vector<std::vector<std::vector<double>>> emigrants(mIslands.size());
+	for (size_t i{}; i < mIslands.size(); ++i) {
+		de::Population const & population{ mIslands[i]->engine.actualPopulation() };
+		size_t const count{ std::min(mParameters.migrantCount, population.size()) };
+		for (size_t m{}; m < count; ++m) {
+			de::Solution const & solution{ population[m] };
+			double const * genes{ solutionData(solution) };
+			emigrants[i].emplace_back(genes, genes + solution.size());
+		}
+	}
+
+	CounterBasedRandom const random(mParameters.seed);
+	for (size_t i{}; i < mIslands.size(); ++i) {
+		for (size_t destination : destinationsOf(i, random)) {
+			std::vector<std::vector<double>> & migrants{ mIslands[destination]->inbox->migrants };
+			migrants.insert(migrants.end(), emigrants[i].begin(), emigrants[i].end());
+			mMigrationCount += emigrants[i].size();
+		}
+	}
+}
@@ -0,0 +1,121 @@
+#pragma once
+#ifndef ISLAND_DIFFERENTIAL_EVOLUTION_H
+#define ISLAND_DIFFERENTIAL_EVOLUTION_H
+
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include <DifferentialEvolution.h>
+#include <OptimizationStrategy.h>
+#include "MigrationCrossover.h"
+#include "CounterBasedRandom.h"
+#include "FitnessStatistics.h"
+
+
+//! \brief Modèle en îles : plusieurs engins `de::DifferentialEvolution` 
+//! évoluent en parallèle et s'échangent périodiquement leurs meilleurs 
+//! individus.
+//!
+//! \details Chaque île possède son propre problème et ses propres 
+//! paramètres (`de::EngineParameters`); des îles hétérogènes sont donc 
+//! possibles. L'évolution procède par époques : chaque île effectue 
+//! `interval` générations sur son propre fil d'exécution, puis les 
+//! `migrantCount` meilleurs individus de chaque île sont envoyés à ses 
+//! voisines selon la topologie choisie. Aucune synchronisation n'est 
+//! nécessaire pendant une époque, ce qui donne une accélération presque 
+//! linéaire même pour des fonctions objectives peu coûteuses.
+//!
+//! Les migrants sont introduits par MigrationCrossover, qui enveloppe la 
+//! stratégie de croisement de chaque île.
+//!
+//! Les stratégies d'initialisation, de mutation et de croisement de 
+//! `delib` partagent des générateurs aléatoires statiques et ne peuvent 
+//! pas s'exécuter sur plusieurs fils à la fois. Les îles ne s'exécutent en 
+//! parallèle que si ces trois stratégies héritent de SeededStrategy pour 
+//! toutes les îles (voir isParallel), comme pour ParameterSweep; sinon, 
+//! elles s'exécutent l'une après l'autre avec les mêmes règles de 
+//! migration.
+class IslandDifferentialEvolution
+{
+public:
+	//! \brief Topologie de migration.
+	enum class Topology
+	{
+		Ring,															//!< L'île i envoie ses migrants à l'île i + 1.
+		Torus,															//!< Les îles forment une grille torique; chacune envoie à ses voisines de droite et du bas.
+		FullyConnected,													//!< Chaque île envoie ses migrants à toutes les autres.
+		Random															//!< À chaque époque, chaque île envoie ses migrants à une autre île tirée au hasard.
+	};
+
+	using Replacement = MigrationCrossover::Replacement;
+
+	//! \brief Paramètres de migration.
+	struct MigrationParameters
+	{
+		size_t interval{ 10 };											//!< Nombre de générations entre deux migrations.
+		size_t migrantCount{ 1 };										//!< Nombre de migrants envoyés par une île à chacune de ses voisines.
+		Topology topology{ Topology::Ring };							//!< Topologie de migration.
+		Replacement replacement{ Replacement::Worst };					//!< Politique de remplacement des individus par les migrants.
+		uint64_t seed{};												//!< Germe de la topologie aléatoire et du remplacement aléatoire.
+	};
+
+	IslandDifferentialEvolution() = default;							//!< Constructeur par défaut.
+	IslandDifferentialEvolution(IslandDifferentialEvolution const &) = delete;
+	IslandDifferentialEvolution(IslandDifferentialEvolution &&) = delete;
+	IslandDifferentialEvolution& operator=(IslandDifferentialEvolution const &) = delete;
+	IslandDifferentialEvolution& operator=(IslandDifferentialEvolution &&) = delete;
+	~IslandDifferentialEvolution() = default;							//!< Destructeur.
+
+	MigrationParameters const & migrationParameters() const;			//!< Retourne les paramètres de migration.
+	//! \brief Détermine les paramètres de migration. Doit être appelée avant 
+	//! d'ajouter les îles. Lance `std::invalid_argument` si l'intervalle est nul 
+	//! ou si des îles existent déjà.
+	void setMigrationParameters(MigrationParameters const & parameters);
+
+	//! \brief Ajoute une île. Le problème doit être alloué dynamiquement; sa 
+	//! propriété est transférée à cet objet. Comme pour 
+	//! `de::DifferentialEvolution`, les paramètres sont appliqués après ceux 
+	//! du problème. Lance `std::invalid_argument` si l'île ne peut pas être 
+	//! configurée.
+	void addIsland(de::SolutionStrategy * solutionStrategy, de::EngineParameters const & parameters);
+
+	size_t islandCount() const;											//!< Retourne le nombre d'îles.
+	de::DifferentialEvolution const & island(size_t index) const;		//!< Retourne l'île demandée.
+	bool isParallel() const;											//!< Indique si les îles s'exécutent sur des fils d'exécution distincts.
+	size_t epoch() const;												//!< Retourne le nombre d'époques effectuées.
+	size_t migrationCount() const;										//!< Retourne le nombre total de migrants envoyés.
+
+	bool isStoppingCriteriaReached() const;								//!< Indique si toutes les îles ont atteint un critère d'arrêt.
+	void processEpoch();												//!< Effectue une époque (interval générations sur chaque île) puis une migration.
+	void process();														//!< Effectue des époques jusqu'à ce que toutes les îles aient atteint un critère d'arrêt.
+
+	//! \brief Retourne l'indice de l'île possédant la meilleure solution selon 
+	//! la stratégie d'optimisation du problème (celle-ci est privée au problème 
+	//! dans `delib` et doit donc être fournie). Lance `std::logic_error` s'il 
+	//! n'y a aucune île.
+	size_t bestIsland(de::OptimizationStrategy const & optimization) const;
+	FitnessStatistics statistics() const;								//!< Retourne les statistiques des « fitness » de toutes les îles réunies.
+
+private:
+	struct Island
+	{
+		de::DifferentialEvolution engine;
+		std::shared_ptr<MigrationCrossover::Inbox> inbox;
+		bool seeded{};
+	};
+
+	MigrationParameters mParameters;
+	std::vector<std::unique_ptr<Island>> mIslands;
+	size_t mEpoch{};
+	size_t mMigrationCount{};
+
+	std::vector<size_t> destinationsOf(size_t index, CounterBasedRandom const & random) const;
+	void migrate();
+
+	static constexpr uint32_t sTopologyStream{ 0x544F504Fu };
+};
+
+
+#endif // ISLAND_DIFFERENTIAL_EVOLUTION_H
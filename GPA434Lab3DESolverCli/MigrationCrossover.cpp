@@ -0,0 +1,102 @@
+#include "MigrationCrossover.h"
+
+
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+#include <Population.h>
+#include "SolutionData.h"
+#include "DonorSampler.h"
+
+
+static const std::string mc_summary("Croisement introduisant les migrants d'un modèle en îles.");
+static const std::string mc_description("Effectue le croisement de la stratégie enveloppée, puis remplace certains essais par les migrants reçus des autres îles. Un migrant ne remplace l'individu visé que s'il lui est supérieur lors de la sélection.");
+
+
+static de::CrossoverStrategy * checked(de::CrossoverStrategy * crossover)
+{
+	if (!crossover) {
+		throw std::invalid_argument("MigrationCrossover: a crossover strategy is required.");
+	}
+	return crossover;
+}
+
+MigrationCrossover::MigrationCrossover(de::CrossoverStrategy * crossover, std::shared_ptr<Inbox> inbox, Replacement replacement, uint64_t seed)
+	: CrossoverStrategy(checked(crossover)->name(), mc_summary, mc_description, crossover->crossoverRate())
+	, mCrossover(crossover)
+	, mInbox(inbox ? std::move(inbox) : std::make_shared<Inbox>())
+	, mReplacement{ replacement }
+	, mRandom(seed)
+{
+}
+
+MigrationCrossover::MigrationCrossover(MigrationCrossover const & other)
+	: CrossoverStrategy(other)
+	, mCrossover(static_cast<de::CrossoverStrategy *>(other.mCrossover->clone()))
+	, mInbox(other.mInbox)
+	, mReplacement{ other.mReplacement }
+	, mRandom(other.mRandom)
+	, mGeneration{ other.mGeneration }
+{
+}
+
+MigrationCrossover& MigrationCrossover::operator=(MigrationCrossover const & other)
+{
+	if (this != &other) {
+		CrossoverStrategy::operator=(other);
+		mCrossover.reset(static_cast<de::CrossoverStrategy *>(other.mCrossover->clone()));
+		mInbox = other.mInbox;
+		mReplacement = other.mReplacement;
+		mRandom = other.mRandom;
+		mGeneration = other.mGeneration;
+	}
+	return *this;
+}
+
+de::CrossoverStrategy const & MigrationCrossover::crossover() const
+{
+	return *mCrossover;
+}
+
+MigrationCrossover::Replacement MigrationCrossover::replacement() const
+{
+	return mReplacement;
+}
+
+void MigrationCrossover::prepare(de::Population const & trialPopulation)
+{
+	mCrossover->prepare(trialPopulation);
+}
+
+void MigrationCrossover::process(de::Population const & actualPopulation, de::Population const & mutantPopulation, de::Population & trialPopulation)
+{
+	// the engine sets the rate on this strategy only
+	mCrossover->setCrossoverRate(crossoverRate());
+	mCrossover->process(actualPopulation, mutantPopulation, trialPopulation);
+
+	std::vector<std::vector<double>> & migrants{ mInbox->migrants };
+	size_t const populationSize{ std::min(actualPopulation.size(), trialPopulation.size()) };
+	// the best individual (index 0, the population is sorted) is never targeted
+	size_t const count{ std::min(migrants.size(), populationSize > 0 ? populationSize - 1 : 0) };
+
+	if (count > 0) {
+		mTargets.resize(count);
+		if (mReplacement == Replacement::Worst) {
+			for (size_t m{}; m < count; ++m) {
+				mTargets[m] = populationSize - 1 - m;
+			}
+		} else {
+			std::array<size_t, 1> const excluded{ 0 };
+			DonorSampler::sample(populationSize, excluded, mTargets, mRandom, mGeneration, sStream, 0);
+		}
+
+		for (size_t m{}; m < count; ++m) {
+			de::Solution & trial{ trialPopulation[mTargets[m]] };
+			std::vector<double> const & genes{ migrants[m] };
+			std::copy_n(genes.begin(), std::min(genes.size(), trial.size()), solutionData(trial));
+		}
+	}
+
+	migrants.clear();
+	++mGeneration;
+}
@@ -0,0 +1,72 @@
+#pragma once
+#ifndef MIGRATION_CROSSOVER_H
+#define MIGRATION_CROSSOVER_H
+
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <CrossoverStrategy.h>
+#include "CounterBasedRandom.h"
+
+
+//! \brief Stratégie de croisement enveloppant une autre stratégie afin 
+//! d'introduire des migrants dans une île.
+//!
+//! \details `de::DifferentialEvolution` ne permet pas de modifier sa 
+//! population de l'extérieur. Les migrants sont donc introduits là où 
+//! l'engin le permet : après le croisement, certaines rangées de la 
+//! population d'essai sont remplacées par les gènes des migrants. Ces 
+//! essais sont ensuite évalués puis confrontés à leur cible par la 
+//! stratégie de sélection; un migrant remplace donc l'individu visé 
+//! seulement s'il lui est supérieur.
+//!
+//! La boîte de réception des migrants est partagée entre toutes les copies 
+//! de la stratégie (les paramètres de l'engin clonent leurs stratégies). 
+//! Elle est remplie par IslandDifferentialEvolution entre deux époques, 
+//! lorsque l'île ne s'exécute pas, puis vidée au croisement suivant.
+class MigrationCrossover : public de::CrossoverStrategy
+{
+public:
+	//! \brief Politique de remplacement des individus par les migrants.
+	enum class Replacement
+	{
+		Worst,															//!< Les migrants visent les pires individus.
+		Random															//!< Les migrants visent des individus tirés au hasard (sauf le meilleur).
+	};
+
+	//! \brief Migrants en attente d'être introduits dans une île.
+	struct Inbox
+	{
+		std::vector<std::vector<double>> migrants;						//!< Gènes des migrants reçus.
+	};
+
+	//! \brief Constructeur. La stratégie `crossover` doit être allouée dynamiquement; sa propriété est transférée à cet objet.
+	MigrationCrossover(de::CrossoverStrategy * crossover, std::shared_ptr<Inbox> inbox, Replacement replacement = Replacement::Worst, uint64_t seed = 0);
+	MigrationCrossover(MigrationCrossover const & other);				//!< Constructeur de copie. La stratégie enveloppée est clonée, la boîte de réception est partagée.
+	MigrationCrossover(MigrationCrossover &&) = default;				//!< Constructeur de déplacement.
+	MigrationCrossover& operator=(MigrationCrossover const & other);	//!< Opérateur d'assignation de copie.
+	MigrationCrossover& operator=(MigrationCrossover &&) = default;		//!< Opérateur d'assignation de déplacement.
+	~MigrationCrossover() override = default;							//!< Destructeur.
+
+	de::CrossoverStrategy const & crossover() const;					//!< Retourne la stratégie de croisement enveloppée.
+	Replacement replacement() const;									//!< Retourne la politique de remplacement.
+
+	void prepare(de::Population const & trialPopulation) override;		//!< Prépare la stratégie enveloppée.
+	void process(de::Population const & actualPopulation, de::Population const & mutantPopulation, de::Population & trialPopulation) override; //!< Effectue le croisement puis introduit les migrants en attente.
+
+	DEFINE_OVERRIDE_CLONE_METHOD(MigrationCrossover)					//!< Macro définissant automatiquement la substitution de la méthode de clonage.
+
+private:
+	std::unique_ptr<de::CrossoverStrategy> mCrossover;
+	std::shared_ptr<Inbox> mInbox;
+	Replacement mReplacement;
+	CounterBasedRandom mRandom;
+	uint32_t mGeneration{};
+	std::vector<size_t> mTargets;										// rangées remplacées, conservées pour éviter une allocation à chaque migration
+
+	static constexpr uint32_t sStream{ 0x4D494752u };
+};
+
+
+#endif // MIGRATION_CROSSOVER_H
@@ -0,0 +1,179 @@
+#include "ParameterSweep.h"
+
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <thread>
+
+#include <DifferentialEvolution.h>
+#include "RunnerOptions.h"
+#include "SeededStrategy.h"
+
+
+std::vector<SweepRun> ParameterSweep::run(RunnerOptions const & base, Options const & options, std::function<void(SweepRun const &)> report)
+{
+	if (options.seedCount == 0) {
+		throw std::invalid_argument("ParameterSweep: at least one seed per configuration is required.");
+	}
+
+	std::vector<RunnerOptions> const grid{ configurations(base, options) };
+	std::vector<SweepRun> runs(grid.size() * options.seedCount);
+
+	size_t threadCount{ 1 };
+	if (isParallel(base, options)) {
+		threadCount = options.threadCount > 0 ? options.threadCount : std::max<size_t>(1, std::thread::hardware_concurrency());
+	}
+	threadCount = std::min(threadCount, runs.size());
+
+	// each worker takes the next run as soon as it is done with the previous one
+	std::atomic<size_t> next{};
+	std::mutex reportMutex;
+	auto work{ [&] {
+			for (size_t i{ next++ }; i < runs.size(); i = next++) {
+				// the problem stays keyed on the base seed: only the strategies' seed varies
+				uint64_t const strategySeed{ base.seed + i % options.seedCount };
+				try {
+					runs[i] = runOne(grid[i / options.seedCount], strategySeed, options.target);
+				} catch (std::exception const & exception) {
+					runs[i].seed = strategySeed;
+					runs[i].error = exception.what();
+				}
+				runs[i].configuration = i / options.seedCount;
+				if (report) {
+					std::lock_guard const lock(reportMutex);
+					report(runs[i]);
+				}
+			}
+		} };
+
+	if (threadCount > 1) {
+		std::vector<std::jthread> workers;
+		workers.reserve(threadCount);
+		for (size_t t{}; t < threadCount; ++t) {
+			workers.emplace_back(work);
+		}
+	} else {
+		work();
+	}
+
+	return runs;
+}
+
+bool ParameterSweep::isParallel(RunnerOptions const & base, Options const & options)
+{
+	// delib's strategies share static random engines: only seeded strategies may run concurrently
+	for (RunnerOptions const & configuration : configurations(base, options)) {
+		std::unique_ptr<de::SolutionStrategy> const solution{ configuration.buildSolution() };
+		de::EngineParameters const parameters{ configuration.buildEngineParameters(*solution) };
+		std::unique_ptr<de::InitializationStrategy> const initialization{ parameters.initializationStrategy() };
+		std::unique_ptr<de::MutationStrategy> const mutation{ parameters.mutationStrategy() };
+		std::unique_ptr<de::CrossoverStrategy> const crossover{ parameters.crossoverStrategy() };
+		if (!dynamic_cast<SeededStrategy *>(initialization.get()) || !dynamic_cast<SeededStrategy *>(mutation.get()) || !dynamic_cast<SeededStrategy *>(crossover.get())) {
+			return false;
+		}
+	}
+	return true;
+}
+
+std::vector<RunnerOptions> ParameterSweep::configurations(RunnerOptions const & base, Options const & options)
+{
+	// an empty list keeps the base value: it counts as a single unspecified value
+	size_t const populationCount{ std::max<size_t>(1, options.populationSizes.size()) };
+	size_t const factorCount{ std::max<size_t>(1, options.mutationFactors.size()) };
+	size_t const rateCount{ std::max<size_t>(1, options.crossoverRates.size()) };
+	size_t const mutationCount{ std::max<size_t>(1, options.mutations.size()) };
+	size_t const crossoverCount{ std::max<size_t>(1, options.crossovers.size()) };
+	size_t const gridSize{ populationCount * factorCount * rateCount * mutationCount * crossoverCount };
+
+	std::vector<size_t> indices(gridSize);
+	std::iota(indices.begin(), indices.end(), size_t{});
+	if (options.sampleCount > 0 && options.sampleCount < gridSize) {
+		// reproducible sample, kept in grid order
+		std::vector<size_t> sample;
+		sample.reserve(options.sampleCount);
+		std::mt19937_64 engine(base.seed);
+		std::sample(indices.begin(), indices.end(), std::back_inserter(sample), options.sampleCount, engine);
+		indices = std::move(sample);
+	}
+
+	std::vector<RunnerOptions> result;
+	result.reserve(indices.size());
+	for (size_t index : indices) {
+		RunnerOptions configuration{ base };
+		if (!options.crossovers.empty()) configuration.crossover = options.crossovers[index % crossoverCount];
+		index /= crossoverCount;
+		if (!options.mutations.empty()) configuration.mutation = options.mutations[index % mutationCount];
+		index /= mutationCount;
+		if (!options.crossoverRates.empty()) configuration.crossoverRate = options.crossoverRates[index % rateCount];
+		index /= rateCount;
+		if (!options.mutationFactors.empty()) configuration.mutationFactor = options.mutationFactors[index % factorCount];
+		index /= factorCount;
+		if (!options.populationSizes.empty()) configuration.populationSize = options.populationSizes[index % populationCount];
+		result.push_back(std::move(configuration));
+	}
+	return result;
+}
+
+SweepRun ParameterSweep::runOne(RunnerOptions const & options, uint64_t strategySeed, std::optional<double> target)
+{
+	std::unique_ptr<de::SolutionStrategy> solution{ options.buildSolution() };
+	std::unique_ptr<de::OptimizationStrategy> const optimization{ options.buildOptimization(*solution) };
+	RunnerOptions strategyOptions{ options };
+	strategyOptions.seed = strategySeed;
+	de::EngineParameters const parameters{ strategyOptions.buildEngineParameters(*solution) };
+
+	SweepRun run;
+	run.seed = strategySeed;
+	run.populationSize = parameters.populationSize();
+	run.mutationFactor = parameters.mutationFactor();
+	run.crossoverRate = parameters.crossoverRate();
+	run.mutation = std::unique_ptr<de::MutationStrategy>(parameters.mutationStrategy())->name();
+	run.crossover = std::unique_ptr<de::CrossoverStrategy>(parameters.crossoverStrategy())->name();
+
+	de::DifferentialEvolution de;
+	if (de.setup(solution.release()) != de::DifferentialEvolution::SetupState::Success) {
+		throw std::invalid_argument("The problem could not be set up.");
+	}
+	// the solution imposes its own parameters during setup: apply ours afterward
+	de.setEngineParameters(parameters);
+	if (!de.isReady()) {
+		throw std::invalid_argument("The engine parameters are invalid.");
+	}
+
+	size_t const initialGeneration{ de.currentGeneration() };
+	// the initial population costs one evaluation per solution, then each generation as many
+	auto checkTarget{ [&] {
+			de::Population const & population{ de.actualPopulation() };
+			if (!run.evaluationsToTarget && population.size() > 0) {
+				// the population is sorted from best to worst
+				double const best{ population[0].fitness() };
+				if (best == *target || optimization->compare(best, *target)) {
+					run.evaluationsToTarget = (1 + de.currentGeneration() - initialGeneration) * population.size();
+				}
+			}
+		} };
+	GenerationStopwatch stopwatch;
+	if (target) {
+		checkTarget();
+		while (!de.isStoppingCriteriaReached()) {
+			de.processToNextGeneration();
+			checkTarget();
+		}
+	} else {
+		de.process();
+	}
+	size_t const generationCount{ de.currentGeneration() - initialGeneration };
+	run.timing = stopwatch.elapsed(generationCount * de.actualPopulation().size(), generationCount);
+
+	run.generationCount = de.currentGeneration();
+	run.bestObjective = de.actualPopulation()[0].objective();
+
+	return run;
+}
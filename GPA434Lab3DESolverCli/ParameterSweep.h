@@ -0,0 +1,95 @@
+#pragma once
+#ifndef PARAMETER_SWEEP_H
+#define PARAMETER_SWEEP_H
+
+
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+#include <vector>
+#include "GenerationTiming.h"
+
+struct RunnerOptions;
+
+
+//! \brief Résultat d'une simulation d'un balayage de paramètres.
+struct SweepRun
+{
+	size_t configuration{};												//!< Indice de la configuration dans le balayage.
+	size_t populationSize{};											//!< Taille de la population utilisée.
+	double mutationFactor{};											//!< Facteur de mutation F utilisé.
+	double crossoverRate{};												//!< Taux de croisement CR utilisé.
+	std::string mutation;												//!< Nom de la stratégie de mutation.
+	std::string crossover;												//!< Nom de la stratégie de croisement.
+	uint64_t seed{};													//!< Germe des stratégies reproductibles (le problème garde celui des options de base).
+	size_t generationCount{};											//!< Nombre de générations effectuées.
+	double bestObjective{};												//!< Valeur objective de la meilleure solution.
+	std::optional<size_t> evaluationsToTarget;							//!< Nombre d'évaluations pour atteindre la cible, y compris celles de la population initiale (non spécifié : cible non atteinte ou absente).
+	GenerationTiming timing;											//!< Temps de l'évolution (l'initialisation est exclue).
+	std::string error;													//!< Message d'erreur si la simulation n'a pas pu être lancée (vide sinon).
+};
+
+
+//! \brief Balayage de paramètres : exécute une simulation pour chaque
+//! configuration d'une grille et pour chaque germe.
+//!
+//! \details La grille est le produit cartésien des listes de valeurs
+//! demandées (tailles de population, F, CR, stratégies de mutation et de
+//! croisement). Une liste vide conserve la valeur des options de base
+//! (RunnerOptions). Avec `sampleCount`, seul un échantillon aléatoire
+//! reproductible de la grille est exécuté. Chaque configuration est
+//! répétée `seedCount` fois, avec les germes `seed`, `seed + 1`, etc.
+//! Ces germes ne s'appliquent qu'aux stratégies : comme pour les îles de 
+//! HeadlessRunner, le problème (décalage et rotation) est toujours construit 
+//! avec le germe des options de base, afin que toutes les simulations 
+//! résolvent le même problème.
+//!
+//! Toutes les simulations sont réparties sur un même bassin de fils
+//! d'exécution, qui prennent la simulation suivante dès qu'ils ont
+//! terminé la précédente. Comme pour IslandDifferentialEvolution, les
+//! stratégies de `delib` partagent des générateurs statiques : le balayage
+//! ne s'exécute en parallèle que si les stratégies d'initialisation, de
+//! mutation et de croisement de toutes les configurations héritent de
+//! SeededStrategy. Sinon, les simulations s'exécutent une à une.
+//!
+//! Avec une cible, la population initiale puis chaque génération sont 
+//! suivies d'une comparaison de la meilleure « fitness » avec la cible. Le 
+//! sens de la comparaison est celui de la stratégie d'optimisation du 
+//! problème (RunnerOptions::buildOptimization). Le décompte des évaluations 
+//! inclut les N évaluations de la population initiale : une cible atteinte 
+//! dès l'initialisation compte N évaluations, puis chaque génération en 
+//! ajoute N.
+class ParameterSweep
+{
+public:
+	struct Options
+	{
+		std::vector<size_t> populationSizes;							//!< Tailles de population (vide : celle des options de base).
+		std::vector<double> mutationFactors;							//!< Facteurs de mutation F (vide : celui des options de base).
+		std::vector<double> crossoverRates;								//!< Taux de croisement CR (vide : celui des options de base).
+		std::vector<std::string> mutations;								//!< Noms courts des stratégies de mutation (vide : celle des options de base).
+		std::vector<std::string> crossovers;							//!< Noms courts des stratégies de croisement (vide : celle des options de base).
+		size_t seedCount{ 1 };											//!< Nombre de germes par configuration.
+		size_t sampleCount{};											//!< Nombre de configurations tirées au hasard (0 : toute la grille).
+		std::optional<double> target;									//!< « Fitness » à atteindre (la valeur objective, puisque les problèmes utilisent la « fitness » identité).
+		size_t threadCount{};											//!< Nombre de fils d'exécution (0 : nombre de cœurs).
+	};
+
+	//! \brief Exécute le balayage. Les résultats sont retournés dans l'ordre
+	//! des configurations puis des germes. `report` est appelé après chaque
+	//! simulation, dans l'ordre où elles se terminent, toujours par un seul
+	//! fil à la fois.
+	static std::vector<SweepRun> run(RunnerOptions const & base, Options const & options, std::function<void(SweepRun const &)> report = {});
+
+	//! \brief Indique si les simulations du balayage peuvent s'exécuter en
+	//! parallèle (voir la description de la classe).
+	static bool isParallel(RunnerOptions const & base, Options const & options);
+
+private:
+	static std::vector<RunnerOptions> configurations(RunnerOptions const & base, Options const & options);
+	static SweepRun runOne(RunnerOptions const & options, uint64_t strategySeed, std::optional<double> target);
+};
+
+
+#endif // PARAMETER_SWEEP_H
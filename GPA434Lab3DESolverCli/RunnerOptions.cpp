@@ -0,0 +1,390 @@
+#include "RunnerOptions.h"
+
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <map>
+#include <stdexcept>
+
+#include <PeakFunctionMinSolution.h>
+#include <PeakFunctionMaxSolution.h>
+#include <PeakFunctionMinMaxSolution.h>
+#include <InitializationBySolution.h>
+#include <InitializationDomainUniform.h>
+#include <AdaptiveDomainNoConstraint.h>
+#include <AdaptiveDomainClamped.h>
+#include <MutationRand1.h>
+#include <MutationBest1.h>
+#include <CrossoverBinomial.h>
+#include <CrossoverExponential.h>
+#include <OptimizationMinimization.h>
+#include <OptimizationMaximization.h>
+
+#include "OpenBoxSolution.h"
+#include "BenchmarkFunctions.h"
+#include "InitializationSeededUniform.h"
+#include "MutationSeededRand1.h"
+#include "MutationSeededBest1.h"
+#include "CrossoverSeededBinomial.h"
+#include "CrossoverSeededExponential.h"
+
+
+template <typename T>
+using Factories = std::map<std::string, std::function<T*()>>;
+
+template <typename T>
+static T* build(Factories<T> const & factories, std::string const & name, std::string const & option)
+{
+	auto it{ factories.find(name) };
+	if (it == factories.end()) {
+		throw std::invalid_argument("Unknown value '" + name + "' for option " + option + ".");
+	}
+	return it->second();
+}
+
+static Factories<de::InitializationStrategy> const initializationFactories{
+	{ "solution", [] { return new de::InitializationBySolution; } },
+	{ "domain", [] { return new de::InitializationDomainUniform; } },
+	{ "seeded", [] { return new InitializationSeededUniform; } }
+};
+
+static Factories<de::AdaptiveDomainStrategy> const adaptiveDomainFactories{
+	{ "none", [] { return new de::AdaptiveDomainNoConstraint; } },
+	{ "clamped", [] { return new de::AdaptiveDomainClamped; } }
+};
+
+static Factories<de::MutationStrategy> const mutationFactories{
+	{ "rand1", [] { return new de::MutationRand1; } },
+	{ "best1", [] { return new de::MutationBest1; } },
+	{ "seeded-rand1", [] { return new MutationSeededRand1; } },
+	{ "seeded-best1", [] { return new MutationSeededBest1; } }
+};
+
+static Factories<de::CrossoverStrategy> const crossoverFactories{
+	{ "binomial", [] { return new de::CrossoverBinomial; } },
+	{ "exponential", [] { return new de::CrossoverExponential; } },
+	{ "seeded-binomial", [] { return new CrossoverSeededBinomial; } },
+	{ "seeded-exponential", [] { return new CrossoverSeededExponential; } }
+};
+
+template <typename T>
+static T* seeded(T* strategy, uint64_t seed)
+{
+	if (SeededStrategy* seededStrategy{ dynamic_cast<SeededStrategy*>(strategy) }) {
+		seededStrategy->setSeed(seed);
+	}
+	return strategy;
+}
+
+static std::map<std::string, IslandDifferentialEvolution::Topology> const topologies{
+	{ "ring", IslandDifferentialEvolution::Topology::Ring },
+	{ "torus", IslandDifferentialEvolution::Topology::Torus },
+	{ "full", IslandDifferentialEvolution::Topology::FullyConnected },
+	{ "random", IslandDifferentialEvolution::Topology::Random }
+};
+
+static std::map<std::string, IslandDifferentialEvolution::Replacement> const replacements{
+	{ "worst", IslandDifferentialEvolution::Replacement::Worst },
+	{ "random", IslandDifferentialEvolution::Replacement::Random }
+};
+
+template <typename T>
+static T toEnum(std::map<std::string, T> const & values, std::string const & value, std::string const & option)
+{
+	auto it{ values.find(value) };
+	if (it == values.end()) {
+		throw std::invalid_argument("Unknown value '" + value + "' for option " + option + ".");
+	}
+	return it->second;
+}
+
+static size_t toSize(std::string const & value, std::string const & option)
+{
+	size_t processed{};
+	unsigned long long result{};
+	try {
+		result = std::stoull(value, &processed);
+	} catch (std::exception const &) {
+		processed = 0;
+	}
+	if (processed == 0 || processed != value.size() || value.front() == '-') {
+		throw std::invalid_argument("Option " + option + " expects a positive integer.");
+	}
+	return static_cast<size_t>(result);
+}
+
+static std::vector<std::string> toNames(std::string const & value)
+{
+	std::vector<std::string> result;
+	size_t start{};
+	while (start <= value.size()) {
+		size_t const end{ std::min(value.find(',', start), value.size()) };
+		result.push_back(value.substr(start, end - start));
+		start = end + 1;
+	}
+	return result;
+}
+
+template <typename T>
+static std::vector<std::string> toNames(Factories<T> const & factories, std::string const & value, std::string const & option)
+{
+	std::vector<std::string> result{ toNames(value) };
+	for (std::string const & name : result) {
+		if (!factories.contains(name)) {
+			throw std::invalid_argument("Unknown value '" + name + "' for option " + option + ".");
+		}
+	}
+	return result;
+}
+
+static std::vector<size_t> toSizes(std::string const & value, std::string const & option)
+{
+	std::vector<size_t> result;
+	for (std::string const & name : toNames(value)) {
+		result.push_back(toSize(name, option));
+	}
+	return result;
+}
+
+static double toReal(std::string const & value, std::string const & option)
+{
+	size_t processed{};
+	double result{};
+	try {
+		result = std::stod(value, &processed);
+	} catch (std::exception const &) {
+		processed = 0;
+	}
+	if (processed == 0 || processed != value.size()) {
+		throw std::invalid_argument("Option " + option + " expects a real number.");
+	}
+	return result;
+}
+
+static std::vector<double> toReals(std::string const & value, std::string const & option)
+{
+	std::vector<double> result;
+	for (std::string const & name : toNames(value)) {
+		result.push_back(toReal(name, option));
+	}
+	return result;
+}
+
+
+
+RunnerOptions RunnerOptions::parse(std::vector<std::string> const & arguments)
+{
+	RunnerOptions options;
+
+	for (size_t i{}; i < arguments.size(); ++i) {
+		std::string const & option{ arguments[i] };
+		if (option == "-h" || option == "--help") {
+			options.help = true;
+			continue;
+		}
+		if (option == "--benchmark") {
+			options.benchmark = true;
+			continue;
+		}
+		if (option == "--sweep") {
+			options.sweep = true;
+			continue;
+		}
+		if (option == "--shift") {
+			options.shifted = true;
+			continue;
+		}
+		if (option == "--rotate") {
+			options.rotated = true;
+			continue;
+		}
+
+		if (i + 1 >= arguments.size()) {
+			throw std::invalid_argument("Missing value for option " + option + ".");
+		}
+		std::string const & value{ arguments[++i] };
+
+		if (option == "--problem") options.problem = value;
+		else if (option == "--width") options.boxWidth = toReal(value, option);
+		else if (option == "--height") options.boxHeight = toReal(value, option);
+		else if (option == "--dimension") options.dimension = toSize(value, option);
+		else if (option == "--population") options.populationSize = toSize(value, option);
+		else if (option == "--generations") options.generationCount = toSize(value, option);
+		else if (option == "--init") options.initialization = value;
+		else if (option == "--adaptive") options.adaptiveDomain = value;
+		else if (option == "--mutation") options.mutation = value;
+		else if (option == "--f") options.mutationFactor = toReal(value, option);
+		else if (option == "--crossover") options.crossover = value;
+		else if (option == "--cr") options.crossoverRate = toReal(value, option);
+		else if (option == "--bench-populations") options.benchmarkOptions.populationSizes = toSizes(value, option);
+		else if (option == "--bench-dimensions") options.benchmarkOptions.dimensions = toSizes(value, option);
+		else if (option == "--bench-time") options.benchmarkOptions.minimumTime = std::chrono::milliseconds(toSize(value, option));
+		else if (option == "--seed") options.seed = toSize(value, option);
+		else if (option == "--islands") options.islandCount = toSize(value, option);
+		else if (option == "--migration-interval") options.migration.interval = toSize(value, option);
+		else if (option == "--migrants") options.migration.migrantCount = toSize(value, option);
+		else if (option == "--topology") options.migration.topology = toEnum(topologies, value, option);
+		else if (option == "--replacement") options.migration.replacement = toEnum(replacements, value, option);
+		else if (option == "--async") options.asyncWorkerCount = toSize(value, option);
+		else if (option == "--checkpoint") options.checkpointPath = value;
+		else if (option == "--checkpoint-every") options.checkpointInterval = toSize(value, option);
+		else if (option == "--resume") options.resumePath = value;
+		else if (option == "--sweep-populations") options.sweepOptions.populationSizes = toSizes(value, option);
+		else if (option == "--sweep-f") options.sweepOptions.mutationFactors = toReals(value, option);
+		else if (option == "--sweep-cr") options.sweepOptions.crossoverRates = toReals(value, option);
+		else if (option == "--sweep-mutations") options.sweepOptions.mutations = toNames(mutationFactories, value, option);
+		else if (option == "--sweep-crossovers") options.sweepOptions.crossovers = toNames(crossoverFactories, value, option);
+		else if (option == "--sweep-seeds") options.sweepOptions.seedCount = toSize(value, option);
+		else if (option == "--sweep-samples") options.sweepOptions.sampleCount = toSize(value, option);
+		else if (option == "--sweep-target") options.sweepOptions.target = toReal(value, option);
+		else if (option == "--threads") options.sweepOptions.threadCount = toSize(value, option);
+		else throw std::invalid_argument("Unknown option " + option + ".");
+	}
+
+	if (options.islandCount == 0) {
+		throw std::invalid_argument("Option --islands expects at least one island.");
+	}
+	if (options.migration.interval == 0) {
+		throw std::invalid_argument("Option --migration-interval expects a positive interval.");
+	}
+	if (options.asyncWorkerCount && options.islandCount > 1) {
+		throw std::invalid_argument("Options --async and --islands cannot be combined.");
+	}
+	if ((options.checkpointPath || options.resumePath) && (options.asyncWorkerCount || options.islandCount > 1)) {
+		throw std::invalid_argument("Options --checkpoint and --resume apply to a single generational engine.");
+	}
+	if (options.checkpointInterval == 0) {
+		throw std::invalid_argument("Option --checkpoint-every expects a positive interval.");
+	}
+	if (options.sweep && (options.benchmark || options.asyncWorkerCount || options.islandCount > 1 || options.checkpointPath || options.resumePath)) {
+		throw std::invalid_argument("Option --sweep runs single generational engines: it cannot be combined with --benchmark, --async, --islands, --checkpoint or --resume.");
+	}
+	if (options.sweepOptions.seedCount == 0) {
+		throw std::invalid_argument("Option --sweep-seeds expects at least one seed.");
+	}
+	options.migration.seed = options.seed;
+
+	return options;
+}
+
+std::string RunnerOptions::usage()
+{
+	return R"(Usage : GPA434Lab3DESolverCli [options]
+        GPA434Lab3DESolverCli --benchmark [options du banc d'essai]
+
+  --problem <nom>        min | max | minmax | openbox | sphere | ellipsoid |
+                         rosenbrock | rastrigin | ackley | griewank |
+                         schwefel | lunacek                          (minmax)
+  --width <réel>         largeur de la feuille pour openbox          (100)
+  --height <réel>        hauteur de la feuille pour openbox          (100)
+  --dimension <n>        dimension des fonctions de test             (10)
+  --shift                déplace l'optimum des fonctions de test
+  --rotate               tourne l'espace des fonctions de test
+  --population <n>       taille de la population                     (selon le problème)
+  --generations <n>      nombre de générations maximum               (selon le problème)
+  --init <nom>           solution | domain | seeded                  (selon le problème)
+  --adaptive <nom>       none | clamped                              (selon le problème)
+  --mutation <nom>       rand1 | best1 | seeded-rand1 | seeded-best1 (selon le problème)
+  --f <réel>             facteur de mutation F                       (selon le problème)
+  --crossover <nom>      binomial | exponential | seeded-binomial |
+                         seeded-exponential                          (selon le problème)
+  --cr <réel>            taux de croisement CR                       (selon le problème)
+  --seed <n>             germe des stratégies reproductibles         (0)
+
+Modèle en îles (îles parallèles avec --init seeded et les stratégies seeded-*) :
+  --islands <n>          nombre d'îles                               (1)
+  --migration-interval <n>  générations entre deux migrations        (10)
+  --migrants <n>         migrants envoyés à chaque voisine           (1)
+  --topology <nom>       ring | torus | full | random                (ring)
+  --replacement <nom>    worst | random                              (worst)
+
+Évolution asynchrone, sans barrière entre les générations (fonctions de test) :
+  --async <n>            nombre de fils d'exécution, 0 : nombre de cœurs
+
+Points de reprise (engin unique) :
+  --checkpoint <fichier> écrit un point de reprise périodiquement et à la fin
+  --checkpoint-every <n> générations entre deux points de reprise      (100)
+  --resume <fichier>     reprend à partir d'un point de reprise
+
+Balayage de paramètres (listes séparées par des virgules; parallèle avec
+--init seeded et les stratégies seeded-*) :
+  --sweep                lance une simulation par configuration et par germe
+  --sweep-populations    tailles de population                       (--population)
+  --sweep-f              facteurs de mutation F                      (--f)
+  --sweep-cr             taux de croisement CR                       (--cr)
+  --sweep-mutations      stratégies de mutation                      (--mutation)
+  --sweep-crossovers     stratégies de croisement                    (--crossover)
+  --sweep-seeds <n>      germes par configuration, à partir de --seed  (1)
+  --sweep-samples <n>    configurations tirées au hasard, 0 : toutes   (0)
+  --sweep-target <réel>  valeur objective à atteindre (évaluations requises,
+                         initialisation comprise)
+  --threads <n>          fils d'exécution, 0 : nombre de cœurs         (0)
+
+Banc d'essai des stratégies :
+  --benchmark            chronomètre chaque stratégie isolément
+  --bench-populations    tailles de population, séparées par des virgules (10,100,1000,10000,100000)
+  --bench-dimensions     dimensions, séparées par des virgules         (2,20,200,2000)
+  --bench-time <ms>      durée minimale de mesure par noyau            (200)
+
+  -h, --help             affiche cette aide
+)";
+}
+
+std::unique_ptr<de::SolutionStrategy> RunnerOptions::buildSolution() const
+{
+	if (problem == "min") return std::make_unique<de::PeakFunctionMinSolution>();
+	if (problem == "max") return std::make_unique<de::PeakFunctionMaxSolution>();
+	if (problem == "minmax") return std::make_unique<de::PeakFunctionMinMaxSolution>();
+	if (problem == "openbox") return std::make_unique<OpenBoxSolution>(boxWidth, boxHeight);
+
+	static std::map<std::string, std::function<BenchmarkFunctionSolution*(size_t)>> const benchmarkFactories{
+		{ "sphere", [](size_t size) { return new SphereSolution(size); } },
+		{ "ellipsoid", [](size_t size) { return new EllipsoidSolution(size); } },
+		{ "rosenbrock", [](size_t size) { return new RosenbrockSolution(size); } },
+		{ "rastrigin", [](size_t size) { return new RastriginSolution(size); } },
+		{ "ackley", [](size_t size) { return new AckleySolution(size); } },
+		{ "griewank", [](size_t size) { return new GriewankSolution(size); } },
+		{ "schwefel", [](size_t size) { return new SchwefelSolution(size); } },
+		{ "lunacek", [](size_t size) { return new LunacekSolution(size); } }
+	};
+	auto it{ benchmarkFactories.find(problem) };
+	if (it != benchmarkFactories.end()) {
+		std::unique_ptr<BenchmarkFunctionSolution> function{ it->second(dimension) };
+		if (shifted) function->setShift(seed);
+		if (rotated) function->setRotation(seed);
+		return function;
+	}
+
+	throw std::invalid_argument("Unknown value '" + problem + "' for option --problem.");
+}
+
+std::unique_ptr<de::OptimizationStrategy> RunnerOptions::buildOptimization(de::SolutionStrategy const & solution) const
+{
+	// mirrors the setOptimizationStrategy call of each problem's constructor
+	if (dynamic_cast<BenchmarkFunctionSolution const *>(&solution)) {
+		return std::make_unique<de::OptimizationMinimization>();
+	}
+	return std::make_unique<de::OptimizationMaximization>();
+}
+
+de::EngineParameters RunnerOptions::buildEngineParameters(de::SolutionStrategy const & solution) const
+{
+	de::EngineParameters parameters{ solution.engineParameters() };
+
+	// the rate and factor belong to the strategies: keep them before replacing the strategies
+	double const factor{ mutationFactor.value_or(parameters.mutationFactor()) };
+	double const rate{ crossoverRate.value_or(parameters.crossoverRate()) };
+
+	if (populationSize) parameters.setPopulationSize(*populationSize);
+	if (generationCount) parameters.setMaxGeneration(*generationCount);
+	if (initialization) parameters.setInitializationStrategy(seeded(build(initializationFactories, *initialization, "--init"), seed));
+	if (adaptiveDomain) parameters.setAdaptiveDomainStrategy(build(adaptiveDomainFactories, *adaptiveDomain, "--adaptive"));
+	if (mutation) parameters.setMutationStrategy(seeded(build(mutationFactories, *mutation, "--mutation"), seed));
+	if (crossover) parameters.setCrossoverStrategy(seeded(build(crossoverFactories, *crossover, "--crossover"), seed));
+
+	parameters.setMutationFactor(factor);
+	parameters.setCrossoverRate(rate);
+
+	return parameters;
+}
@@ -0,0 +1,112 @@
+#pragma once
+#ifndef RUNNER_OPTIONS_H
+#define RUNNER_OPTIONS_H
+
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+#include <EngineParameters.h>
+#include <OptimizationStrategy.h>
+#include <SolutionStrategy.h>
+#include "StrategyBenchmark.h"
+#include "IslandDifferentialEvolution.h"
+#include "ParameterSweep.h"
+
+
+//! \brief Options d'une simulation lancée en ligne de commande.
+//!
+//! \details Les options non spécifiées conservent la valeur proposée par 
+//! le problème (voir `de::SolutionStrategy::engineParameters`). Les 
+//! stratégies sont désignées par un nom court :
+//! 
+//!	| Option           | Valeurs possibles                                   |
+//!	|------------------|-----------------------------------------------------|
+//!	| `--problem`      | `min`, `max`, `minmax`, `openbox`, `sphere`,        |
+//!	|                  | `ellipsoid`, `rosenbrock`, `rastrigin`, `ackley`,   |
+//!	|                  | `griewank`, `schwefel`, `lunacek`                   |
+//!	| `--init`         | `solution`, `domain`, `seeded`                      |
+//!	| `--adaptive`     | `none`, `clamped`                                   |
+//!	| `--mutation`     | `rand1`, `best1`, `seeded-rand1`, `seeded-best1`    |
+//!	| `--crossover`    | `binomial`, `exponential`, `seeded-binomial`,       |
+//!	|                  | `seeded-exponential`                                |
+//!	| `--topology`     | `ring`, `torus`, `full`, `random`                   |
+//!	| `--replacement`  | `worst`, `random`                                   |
+//! 
+//! Le germe (`--seed`) est transmis à toutes les stratégies héritant de 
+//! SeededStrategy. Il détermine aussi le déplacement et la rotation des 
+//! fonctions de test (`--shift` et `--rotate`).
+//! 
+//! Avec `--islands`, la simulation utilise le modèle en îles 
+//! (IslandDifferentialEvolution). Toutes les îles résolvent le même 
+//! problème avec les mêmes paramètres, mais l'île _k_ reçoit le germe 
+//! `seed + k`.
+//! 
+//! Avec `--async`, la simulation utilise l'évolution asynchrone 
+//! (SteadyStateDifferentialEvolution), réservée aux fonctions de test. Le 
+//! budget d'évaluations est la taille de population multipliée par le 
+//! nombre de générations.
+//! 
+//! `--checkpoint` écrit un point de reprise (Checkpoint) toutes les 
+//! `--checkpoint-every` générations et à la fin; `--resume` reprend la 
+//! simulation à partir d'un point de reprise, avec les mêmes options que 
+//! la simulation d'origine.
+//! 
+//! `--sweep` lance un balayage de paramètres (ParameterSweep) plutôt 
+//! qu'une simulation : les options `--sweep-*` donnent les listes de 
+//! valeurs, séparées par des virgules, et les autres options servent de 
+//! configuration de base.
+struct RunnerOptions
+{
+	std::string problem{ "minmax" };									//!< Nom court du problème.
+	double boxWidth{ 100.0 };											//!< Largeur de la feuille (problème `openbox`).
+	double boxHeight{ 100.0 };											//!< Hauteur de la feuille (problème `openbox`).
+	size_t dimension{ 10 };												//!< Dimension des fonctions de test.
+	bool shifted{};														//!< Déplace l'optimum des fonctions de test.
+	bool rotated{};														//!< Tourne l'espace des fonctions de test.
+
+	std::optional<size_t> populationSize;								//!< Taille de la population.
+	std::optional<size_t> generationCount;								//!< Nombre de générations maximum.
+	std::optional<std::string> initialization;							//!< Nom court de la stratégie d'initialisation.
+	std::optional<std::string> adaptiveDomain;							//!< Nom court de la stratégie de gestion du domaine.
+	std::optional<std::string> mutation;								//!< Nom court de la stratégie de mutation.
+	std::optional<double> mutationFactor;								//!< Facteur de mutation F.
+	std::optional<std::string> crossover;								//!< Nom court de la stratégie de croisement.
+	std::optional<double> crossoverRate;								//!< Taux de croisement CR.
+	uint64_t seed{};													//!< Germe des stratégies reproductibles.
+
+	size_t islandCount{ 1 };											//!< Nombre d'îles (1 : engin unique).
+	IslandDifferentialEvolution::MigrationParameters migration;			//!< Paramètres de migration du modèle en îles.
+	std::optional<size_t> asyncWorkerCount;								//!< Nombre de fils de l'évolution asynchrone (0 : nombre de cœurs). Non spécifié : évolution par générations.
+
+	std::optional<std::filesystem::path> checkpointPath;				//!< Fichier où écrire les points de reprise.
+	size_t checkpointInterval{ 100 };									//!< Nombre de générations entre deux points de reprise.
+	std::optional<std::filesystem::path> resumePath;					//!< Point de reprise à partir duquel reprendre la simulation.
+
+	bool benchmark{};													//!< Lance le banc d'essai des stratégies plutôt qu'une simulation.
+	StrategyBenchmark::Options benchmarkOptions;						//!< Options du banc d'essai.
+
+	bool sweep{};														//!< Lance un balayage de paramètres plutôt qu'une simulation.
+	ParameterSweep::Options sweepOptions;								//!< Options du balayage de paramètres.
+
+	bool help{};														//!< Affiche l'aide plutôt que de lancer une simulation.
+
+	//! \brief Interprète les arguments de la ligne de commande (sans le nom du programme). 
+	//! Lance `std::invalid_argument` si un argument est invalide.
+	static RunnerOptions parse(std::vector<std::string> const & arguments);
+	static std::string usage();											//!< Retourne le texte d'aide.
+
+	std::unique_ptr<de::SolutionStrategy> buildSolution() const;		//!< Construit le problème. Lance `std::invalid_argument` si le nom est inconnu.
+	//! \brief Construit la stratégie d'optimisation du problème, celle qu'il 
+	//! passe à `setOptimizationStrategy` (privée dans `delib`) : minimisation 
+	//! pour les fonctions de test, maximisation pour `openbox` et, comme le 
+	//! défaut de `de::SolutionStrategy`, pour les fonctions `peak`.
+	std::unique_ptr<de::OptimizationStrategy> buildOptimization(de::SolutionStrategy const & solution) const;
+	de::EngineParameters buildEngineParameters(de::SolutionStrategy const & solution) const; //!< Construit les paramètres à partir de ceux du problème et des options spécifiées. Lance `std::invalid_argument` si un nom de stratégie est inconnu.
+};
+
+
+#endif // RUNNER_OPTIONS_H
@@ -0,0 +1,208 @@
+#include "SteadyStateDifferentialEvolution.h"
+
+
+#include <algorithm>
+#include <array>
+#include <exception>
+#include <stdexcept>
+#include <thread>
+#include "DonorSampler.h"
+
+
+SteadyStateDifferentialEvolution::SteadyStateDifferentialEvolution(BenchmarkFunctionSolution const & problem, Parameters const & parameters)
+	: mProblem(static_cast<BenchmarkFunctionSolution *>(problem.clone()))
+	, mParameters{ parameters }
+	, mWorkerCount{ parameters.workerCount > 0 ? parameters.workerCount : std::max<size_t>(std::thread::hardware_concurrency(), 1) }
+	, mSlots(parameters.populationSize)
+	, mRandom(parameters.seed)
+{
+	// rand/1 needs three donors distinct from the target
+	if (parameters.populationSize < 4) {
+		throw std::invalid_argument("SteadyStateDifferentialEvolution: the population needs at least 4 individuals.");
+	}
+
+	de::SolutionDomain const & domain{ mProblem->domain() };
+	size_t const dimension{ mProblem->dimension() };
+	mLower.resize(dimension);
+	mUpper.resize(dimension);
+	for (size_t j{}; j < dimension; ++j) {
+		mLower[j] = domain[j].lower();
+		mUpper[j] = domain[j].upper();
+	}
+}
+
+SteadyStateDifferentialEvolution::Parameters const & SteadyStateDifferentialEvolution::parameters() const
+{
+	return mParameters;
+}
+
+size_t SteadyStateDifferentialEvolution::workerCount() const
+{
+	return mWorkerCount;
+}
+
+size_t SteadyStateDifferentialEvolution::evaluationCount() const
+{
+	return mEvaluationCount;
+}
+
+size_t SteadyStateDifferentialEvolution::replacementCount() const
+{
+	return mReplacementCount;
+}
+
+void SteadyStateDifferentialEvolution::process()
+{
+	mTicket = 0;
+	mEvaluationCount = 0;
+	mReplacementCount = 0;
+
+	// the donors must all exist: the initialization is the only barrier
+	runWorkers(&SteadyStateDifferentialEvolution::initialize);
+	mTicket = mSlots.size();
+	runWorkers(&SteadyStateDifferentialEvolution::evolve);
+}
+
+void SteadyStateDifferentialEvolution::runWorkers(void (SteadyStateDifferentialEvolution::*work)())
+{
+	std::vector<std::exception_ptr> errors(mWorkerCount);
+	{
+		std::vector<std::jthread> workers;
+		workers.reserve(mWorkerCount);
+		for (size_t w{}; w < mWorkerCount; ++w) {
+			workers.emplace_back([this, work, &errors, w] {
+				try {
+					(this->*work)();
+				} catch (...) {
+					errors[w] = std::current_exception();
+				}
+			});
+		}
+	}
+	for (std::exception_ptr const & error : errors) {
+		if (error) {
+			std::rethrow_exception(error);
+		}
+	}
+}
+
+void SteadyStateDifferentialEvolution::initialize()
+{
+	size_t const dimension{ mLower.size() };
+	std::vector<double> genes(dimension);
+
+	for (size_t i{ mTicket++ }; i < mSlots.size(); i = mTicket++) {
+		for (size_t j{}; j < dimension; ++j) {
+			genes[j] = mRandom.uniform(mLower[j], mUpper[j], 0, sInitializationStream, static_cast<uint32_t>(i), static_cast<uint32_t>(j));
+		}
+		double const objective{ mProblem->evaluate(genes.data()) };
+
+		Slot & slot{ mSlots[i] };
+		std::scoped_lock const lock(slot.mutex);
+		slot.genes = genes;
+		slot.objective = objective;
+		++mEvaluationCount;
+	}
+}
+
+void SteadyStateDifferentialEvolution::evolve()
+{
+	size_t const dimension{ mLower.size() };
+	size_t const populationSize{ mSlots.size() };
+	double const f{ mParameters.mutationFactor };
+	double const cr{ mParameters.crossoverRate };
+
+	std::vector<double> trial(dimension);
+	std::array<std::vector<double>, 3> donors;
+	for (std::vector<double> & donor : donors) {
+		donor.resize(dimension);
+	}
+
+	for (size_t ticket{ mTicket++ }; ticket < mParameters.evaluationCount; ticket = mTicket++) {
+		size_t const target{ ticket % populationSize };
+		// the counter is the ticket: every draw is tied to one evaluation
+		uint32_t const high{ static_cast<uint32_t>(ticket >> 32) };
+		uint32_t const low{ static_cast<uint32_t>(ticket) };
+
+		std::array<size_t, 3> indices{};
+		std::array<size_t, 1> const excluded{ target };
+		DonorSampler::sample(populationSize, excluded, indices, mRandom, high, sDonorStream, low);
+
+		// copy each individual under its own lock, one at a time (no lock ordering needed)
+		{
+			std::scoped_lock const lock(mSlots[target].mutex);
+			std::copy(mSlots[target].genes.begin(), mSlots[target].genes.end(), trial.begin());
+		}
+		for (size_t d{}; d < donors.size(); ++d) {
+			Slot const & slot{ mSlots[indices[d]] };
+			std::scoped_lock const lock(slot.mutex);
+			std::copy(slot.genes.begin(), slot.genes.end(), donors[d].begin());
+		}
+
+		size_t const forcedGene{ mRandom.index(dimension, high, sForcedGeneStream, low, 0) };
+		for (size_t j{}; j < dimension; ++j) {
+			if (j == forcedGene || mRandom.uniform(high, sCrossoverStream, low, static_cast<uint32_t>(j)) < cr) {
+				trial[j] = std::clamp(donors[0][j] + f * (donors[1][j] - donors[2][j]), mLower[j], mUpper[j]);
+			}
+		}
+
+		double const objective{ mProblem->evaluate(trial.data()) };
+
+		// the target may have been replaced meanwhile: compare with its current value
+		Slot & slot{ mSlots[target] };
+		{
+			std::scoped_lock const lock(slot.mutex);
+			if (objective <= slot.objective) {
+				std::copy(trial.begin(), trial.end(), slot.genes.begin());
+				slot.objective = objective;
+				++mReplacementCount;
+			}
+		}
+		++mEvaluationCount;
+	}
+}
+
+size_t SteadyStateDifferentialEvolution::bestIndex() const
+{
+	size_t best{};
+	double bestObjective{};
+	for (size_t i{}; i < mSlots.size(); ++i) {
+		std::scoped_lock const lock(mSlots[i].mutex);
+		if (i == 0 || mSlots[i].objective < bestObjective) {
+			best = i;
+			bestObjective = mSlots[i].objective;
+		}
+	}
+	return best;
+}
+
+double SteadyStateDifferentialEvolution::bestObjective() const
+{
+	Slot const & slot{ mSlots[bestIndex()] };
+	std::scoped_lock const lock(slot.mutex);
+	return slot.objective;
+}
+
+std::vector<double> SteadyStateDifferentialEvolution::bestSolution() const
+{
+	Slot const & slot{ mSlots[bestIndex()] };
+	std::scoped_lock const lock(slot.mutex);
+	return slot.genes;
+}
+
+std::string SteadyStateDifferentialEvolution::bestSolutionInfo() const
+{
+	Slot const & slot{ mSlots[bestIndex()] };
+	std::scoped_lock const lock(slot.mutex);
+	return mProblem->describe(slot.genes.data(), slot.objective);
+}
+
+FitnessStatistics SteadyStateDifferentialEvolution::statistics() const
+{
+	std::vector<double> objectives(mSlots.size());
+	for (size_t i{}; i < mSlots.size(); ++i) {
+		std::scoped_lock const lock(mSlots[i].mutex);
+		objectives[i] = mSlots[i].objective;
+	}
+	return FitnessStatistics::of(objectives.data(), objectives.size());
+}
@@ -0,0 +1,106 @@
+#pragma once
+#ifndef STEADY_STATE_DIFFERENTIAL_EVOLUTION_H
+#define STEADY_STATE_DIFFERENTIAL_EVOLUTION_H
+
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "BenchmarkFunctionSolution.h"
+#include "CounterBasedRandom.h"
+#include "FitnessStatistics.h"
+
+
+//! \brief Évolution différentielle asynchrone (« steady-state »), sans 
+//! barrière entre les générations.
+//!
+//! \details `de::DifferentialEvolution::processToNextGeneration` évalue 
+//! tous les essais avant la sélection : une évaluation lente immobilise 
+//! tous les fils d'exécution. Ici, chaque fil répète indépendamment les 
+//! étapes suivantes :
+//!  1. prendre le prochain individu cible (à tour de rôle);
+//!  2. construire un essai (DE/rand/1/bin, borné au domaine) à partir de 
+//!     la population courante;
+//!  3. évaluer l'essai;
+//!  4. remplacer immédiatement la cible si l'essai lui est supérieur.
+//!
+//! Chaque individu est protégé par son propre verrou, tenu seulement le 
+//! temps de copier ses gènes ou de le remplacer : l'évaluation se fait 
+//! sans aucun verrou. L'avancement se mesure en évaluations complétées; 
+//! une « génération » équivaut à N évaluations.
+//!
+//! Les fonctions objectives de `de::SolutionStrategy` sont protégées et 
+//! réservées à `de::DifferentialEvolution`. Ce mode s'applique donc aux 
+//! fonctions de test (BenchmarkFunctionSolution), dont l'évaluation est 
+//! publique et peut s'exécuter sur plusieurs fils. Les tirages sont 
+//! reproductibles (CounterBasedRandom), mais l'ordre des remplacements 
+//! dépend de l'ordonnancement des fils : avec plus d'un fil, deux 
+//! exécutions ne donnent pas le même résultat.
+class SteadyStateDifferentialEvolution
+{
+public:
+	//! \brief Paramètres de l'évolution asynchrone.
+	struct Parameters
+	{
+		size_t populationSize{ 100 };									//!< Taille de la population (au moins 4).
+		size_t evaluationCount{ 100000 };								//!< Nombre d'évaluations à effectuer, incluant l'initialisation.
+		double mutationFactor{ 0.5 };									//!< Facteur de mutation F.
+		double crossoverRate{ 0.9 };									//!< Taux de croisement CR.
+		size_t workerCount{};											//!< Nombre de fils d'exécution (0 : nombre de cœurs).
+		uint64_t seed{};												//!< Germe des tirages.
+	};
+
+	//! \brief Constructeur. Le problème est copié. Lance `std::invalid_argument` si la population est trop petite.
+	SteadyStateDifferentialEvolution(BenchmarkFunctionSolution const & problem, Parameters const & parameters);
+	SteadyStateDifferentialEvolution(SteadyStateDifferentialEvolution const &) = delete;
+	SteadyStateDifferentialEvolution(SteadyStateDifferentialEvolution &&) = delete;
+	SteadyStateDifferentialEvolution& operator=(SteadyStateDifferentialEvolution const &) = delete;
+	SteadyStateDifferentialEvolution& operator=(SteadyStateDifferentialEvolution &&) = delete;
+	~SteadyStateDifferentialEvolution() = default;						//!< Destructeur.
+
+	Parameters const & parameters() const;								//!< Retourne les paramètres.
+	size_t workerCount() const;											//!< Retourne le nombre de fils d'exécution utilisés.
+	size_t evaluationCount() const;										//!< Retourne le nombre d'évaluations complétées.
+	size_t replacementCount() const;									//!< Retourne le nombre d'essais ayant remplacé leur cible.
+
+	void process();														//!< Initialise la population puis évolue jusqu'à épuisement du budget d'évaluations.
+
+	double bestObjective() const;										//!< Retourne la meilleure valeur objective (à minimiser).
+	std::vector<double> bestSolution() const;							//!< Retourne les gènes de la meilleure solution.
+	std::string bestSolutionInfo() const;								//!< Décrit la meilleure solution.
+	FitnessStatistics statistics() const;								//!< Retourne les statistiques des valeurs objectives de la population.
+
+private:
+	struct Slot
+	{
+		mutable std::mutex mutex;
+		std::vector<double> genes;
+		double objective{};
+	};
+
+	std::unique_ptr<BenchmarkFunctionSolution> mProblem;
+	Parameters mParameters;
+	size_t mWorkerCount;
+	std::vector<double> mLower;
+	std::vector<double> mUpper;
+	std::vector<Slot> mSlots;
+	CounterBasedRandom mRandom;
+	std::atomic<size_t> mTicket{};
+	std::atomic<size_t> mEvaluationCount{};
+	std::atomic<size_t> mReplacementCount{};
+
+	void runWorkers(void (SteadyStateDifferentialEvolution::*work)());
+	void initialize();
+	void evolve();
+	size_t bestIndex() const;
+
+	static constexpr uint32_t sInitializationStream{ 0x53534931u };
+	static constexpr uint32_t sDonorStream{ 0x53534432u };
+	static constexpr uint32_t sCrossoverStream{ 0x53534333u };
+	static constexpr uint32_t sForcedGeneStream{ 0x53534A34u };
+};
+
+
+#endif // STEADY_STATE_DIFFERENTIAL_EVOLUTION_H
@@ -0,0 +1,154 @@
+#include "StrategyBenchmark.h"
+
+
+#include <memory>
+
+#include <DifferentialEvolution.h>
+#include <Population.h>
+#include <OptimizationMinimization.h>
+#include <InitializationDomainUniform.h>
+#include <AdaptiveDomainClamped.h>
+#include <MutationRand1.h>
+#include <MutationBest1.h>
+#include <CrossoverBinomial.h>
+#include <CrossoverExponential.h>
+#include <SelectionBestFitness.h>
+
+#include "InitializationSeededUniform.h"
+#include "MutationSeededRand1.h"
+#include "MutationSeededBest1.h"
+#include "CrossoverSeededBinomial.h"
+#include "CrossoverSeededExponential.h"
+#include "GeneKernels.h"
+#include "BenchmarkFunctions.h"
+
+
+std::vector<KernelMeasure> StrategyBenchmark::run(Options const & options, std::function<void(KernelMeasure const &)> report)
+{
+	std::vector<KernelMeasure> measures;
+	auto add{ [&](KernelMeasure const & measure) {
+			measures.push_back(measure);
+			if (report) report(measure);
+		} };
+
+	for (size_t dimension : options.dimensions) {
+		for (size_t populationSize : options.populationSizes) {
+			if (dimension == 0 || populationSize < 5 || populationSize * dimension > options.maximumGeneCount) {
+				continue;
+			}
+
+			SphereSolution const solution(dimension);
+			de::SolutionDomain const & domain{ solution.domain() };
+			de::Population actual(populationSize, domain);
+			de::Population mutant(populationSize, domain);
+			de::Population trial(populationSize, domain);
+			de::OptimizationMinimization const optimization;
+			size_t const unlimited{ static_cast<size_t>(-1) };
+
+			auto time{ [&](std::string const & kernel, double doublesPerGene, std::function<void()> const & call) {
+					add(measure(kernel, populationSize, dimension, doublesPerGene, options.minimumTime, unlimited, call));
+				} };
+
+			de::InitializationDomainUniform initializationDomainUniform;
+			InitializationSeededUniform initializationSeededUniform;
+			// like the engine, each strategy is prepared before it processes a population
+			initializationDomainUniform.prepare(actual);
+			initializationSeededUniform.prepare(actual);
+			time(initializationDomainUniform.name(), 1.0, [&] { initializationDomainUniform.process(solution, actual); });
+			time(initializationSeededUniform.name(), 1.0, [&] { initializationSeededUniform.process(solution, actual); });
+
+			de::MutationRand1 mutationRand1;
+			de::MutationBest1 mutationBest1;
+			MutationSeededRand1 mutationSeededRand1;
+			MutationSeededBest1 mutationSeededBest1;
+			// delib's mutations size their donor distribution to the population in prepare
+			mutationRand1.prepare(actual, mutant);
+			mutationBest1.prepare(actual, mutant);
+			mutationSeededRand1.prepare(actual, mutant);
+			mutationSeededBest1.prepare(actual, mutant);
+			time(mutationRand1.name(), 4.0, [&] { mutationRand1.process(actual, mutant); });
+			time(mutationBest1.name(), 4.0, [&] { mutationBest1.process(actual, mutant); });
+
+			de::CrossoverBinomial crossoverBinomial;
+			de::CrossoverExponential crossoverExponential;
+			CrossoverSeededBinomial crossoverSeededBinomial;
+			CrossoverSeededExponential crossoverSeededExponential;
+			// delib's crossovers set their Bernoulli probability to CR in prepare
+			crossoverBinomial.prepare(trial);
+			crossoverExponential.prepare(trial);
+			crossoverSeededBinomial.prepare(trial);
+			crossoverSeededExponential.prepare(trial);
+			time(crossoverBinomial.name(), 3.0, [&] { crossoverBinomial.process(actual, mutant, trial); });
+			time(crossoverExponential.name(), 3.0, [&] { crossoverExponential.process(actual, mutant, trial); });
+			time(crossoverSeededExponential.name(), 3.0, [&] { crossoverSeededExponential.process(actual, mutant, trial); });
+
+			// the vectorized seeded strategies are measured with each instruction set supported by the processor
+			GeneKernels::InstructionSet const defaultInstructionSet{ GeneKernels::active() };
+			for (GeneKernels::InstructionSet instructionSet : { GeneKernels::InstructionSet::Portable, GeneKernels::InstructionSet::Avx2, GeneKernels::InstructionSet::Avx512 }) {
+				if (!GeneKernels::setActive(instructionSet)) {
+					continue;
+				}
+				std::string const suffix{ std::string(" [") + GeneKernels::name(instructionSet) + "]" };
+				time(mutationSeededRand1.name() + suffix, 4.0, [&] { mutationSeededRand1.process(actual, mutant); });
+				time(mutationSeededBest1.name() + suffix, 4.0, [&] { mutationSeededBest1.process(actual, mutant); });
+				time(crossoverSeededBinomial.name() + suffix, 3.0, [&] { crossoverSeededBinomial.process(actual, mutant, trial); });
+			}
+			GeneKernels::setActive(defaultInstructionSet);
+
+			// no copy model for the last two: every trial is inside the domain, so clamping writes nothing, and
+			// the fitness values can only be set by the engine, so selection never replaces anything
+			de::AdaptiveDomainClamped adaptiveDomainClamped;
+			adaptiveDomainClamped.prepare(actual);
+			time(adaptiveDomainClamped.name(), 0.0, [&] { adaptiveDomainClamped.process(domain, trial); });
+
+			de::SelectionBestFitness selectionBestFitness;
+			selectionBestFitness.prepare(actual);
+			time(selectionBestFitness.name(), 0.0, [&] { selectionBestFitness.process(optimization, actual, trial); });
+
+			if (populationSize >= de::EngineParameters::minimumPopulationSize() && populationSize <= de::EngineParameters::maximumPopulationSize()) {
+				de::EngineParameters parameters{ solution.engineParameters() };
+				parameters.setPopulationSize(populationSize);
+				parameters.setMaxGeneration(de::EngineParameters::maximumGenerationCount());
+
+				de::DifferentialEvolution de;
+				de.setup(solution.clone());
+				de.setEngineParameters(parameters);
+				// leave a margin so the stopping criterion is never reached during the measure
+				size_t const maximumIterations{ de::EngineParameters::maximumGenerationCount() / 2 };
+				add(measure("Génération complète", populationSize, dimension, 0.0, options.minimumTime, maximumIterations, [&] { de.processToNextGeneration(); }));
+			}
+		}
+	}
+
+	return measures;
+}
+
+KernelMeasure StrategyBenchmark::measure(std::string const & kernel, size_t populationSize, size_t dimension, double doublesPerGene, std::chrono::milliseconds minimumTime, size_t maximumIterations, std::function<void()> const & call)
+{
+	using Clock = std::chrono::steady_clock;
+
+	// warm-up: caches, lazily grown buffers and first touch of the pages
+	call();
+
+	size_t iterations{};
+	Clock::time_point const start{ Clock::now() };
+	Clock::duration elapsed{};
+	do {
+		call();
+		++iterations;
+		elapsed = Clock::now() - start;
+	} while ((elapsed < minimumTime || iterations < 3) && iterations < maximumIterations);
+
+	double const genes{ static_cast<double>(iterations) * static_cast<double>(populationSize) * static_cast<double>(dimension) };
+	double const nanoseconds{ std::chrono::duration<double, std::nano>(elapsed).count() };
+
+	KernelMeasure result;
+	result.kernel = kernel;
+	result.populationSize = populationSize;
+	result.dimension = dimension;
+	result.iterations = iterations;
+	result.nanosecondsPerGene = nanoseconds / genes;
+	result.bytesPerGene = doublesPerGene * sizeof(double);
+	result.gigabytesPerSecond = result.bytesPerGene / result.nanosecondsPerGene;
+	return result;
+}
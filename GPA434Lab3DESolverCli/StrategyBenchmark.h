@@ -0,0 +1,67 @@
+#pragma once
+#ifndef STRATEGY_BENCHMARK_H
+#define STRATEGY_BENCHMARK_H
+
+
+#include <chrono>
+#include <functional>
+#include <string>
+#include <vector>
+
+
+//! \brief Mesure d'un noyau de stratégie pour une taille de population et 
+//! une dimension données.
+struct KernelMeasure
+{
+	std::string kernel;													//!< Nom du noyau mesuré.
+	size_t populationSize{};											//!< Taille de la population.
+	size_t dimension{};													//!< Dimension du problème.
+	size_t iterations{};												//!< Nombre d'appels chronométrés.
+	double nanosecondsPerGene{};										//!< Temps moyen par individu et par gène.
+	double bytesPerGene{};												//!< Octets lus et écrits par individu et par gène (modèle, voir StrategyBenchmark).
+	double gigabytesPerSecond{};										//!< Débit mémoire correspondant.
+};
+
+
+//! \brief Banc d'essai chronométrant chaque stratégie isolément.
+//!
+//! \details Chaque noyau est appelé sur des populations réelles 
+//! (`de::Population`) pour toutes les combinaisons de tailles de population 
+//! et de dimensions demandées. Les appels sont répétés jusqu'à atteindre la 
+//! durée minimale, après un appel de réchauffement.
+//! 
+//! Les octets déplacés suivent un modèle simple, en doubles lus et écrits 
+//! par gène : 4 pour une mutation (3 donneurs, 1 mutant), 3 pour un 
+//! croisement, 1 pour l'initialisation. Le confinement au domaine et la 
+//! sélection n'ont pas de débit (0) : les vecteurs d'essai sont tous dans 
+//! le domaine et les « fitness », que seul l'engin peut attribuer, gardent 
+//! leur valeur par défaut. Ces deux noyaux ne copient donc rien, et leur 
+//! temps est celui du parcours seul.
+//! 
+//! `Population::sort`, `Population::processStatistics` et `History::add` 
+//! sont privés dans `delib` : leur coût est inclus dans la ligne 
+//! « Génération complète », qui chronomètre 
+//! `DifferentialEvolution::processToNextGeneration` sur la sphère. Cette 
+//! ligne n'est produite que pour les tailles de population acceptées par 
+//! `de::EngineParameters`.
+class StrategyBenchmark
+{
+public:
+	struct Options
+	{
+		std::vector<size_t> populationSizes{ 10, 100, 1000, 10000, 100000 };	//!< Tailles de population à mesurer.
+		std::vector<size_t> dimensions{ 2, 20, 200, 2000 };						//!< Dimensions à mesurer.
+		size_t maximumGeneCount{ 20'000'000 };									//!< Combinaisons ignorées au-delà de ce nombre de gènes par population (mémoire).
+		std::chrono::milliseconds minimumTime{ 200 };							//!< Durée minimale de mesure par noyau.
+	};
+
+	//! \brief Mesure tous les noyaux. `report` est appelé après chaque 
+	//! mesure, ce qui permet d'afficher les résultats au fur et à mesure.
+	static std::vector<KernelMeasure> run(Options const & options, std::function<void(KernelMeasure const &)> report = {});
+
+private:
+	static KernelMeasure measure(std::string const & kernel, size_t populationSize, size_t dimension, double doublesPerGene, std::chrono::milliseconds minimumTime, size_t maximumIterations, std::function<void()> const & call);
+};
+
+
+#endif // STRATEGY_BENCHMARK_H
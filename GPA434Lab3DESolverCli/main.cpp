@@ -0,0 +1,147 @@
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#endif
+
+#include "RunnerOptions.h"
+#include "HeadlessRunner.h"
+#include "StrategyBenchmark.h"
+#include "ParameterSweep.h"
+
+
+static void printMeasure(KernelMeasure const & measure)
+{
+	std::cout << std::left << std::setw(36) << measure.kernel << std::right
+			  << std::setw(8) << measure.populationSize
+			  << std::setw(7) << measure.dimension
+			  << std::setw(10) << measure.iterations
+			  << std::fixed << std::setprecision(3)
+			  << std::setw(12) << measure.nanosecondsPerGene
+			  << std::setprecision(0) << std::setw(9) << measure.bytesPerGene
+			  << std::setprecision(2) << std::setw(9) << measure.gigabytesPerSecond
+			  << std::defaultfloat << std::endl;
+}
+
+static void runBenchmark(StrategyBenchmark::Options const & options)
+{
+	std::cout << std::left << std::setw(36) << "Noyau" << std::right
+			  << std::setw(8) << "N"
+			  << std::setw(7) << "D"
+			  << std::setw(10) << "Appels"
+			  << std::setw(12) << "ns/gène"
+			  << std::setw(9) << "o/gène"
+			  << std::setw(9) << "Go/s" << '\n';
+	StrategyBenchmark::run(options, printMeasure);
+}
+
+static void runSweep(RunnerOptions const & options)
+{
+	using Milliseconds = std::chrono::duration<double, std::milli>;
+
+	bool const parallel{ ParameterSweep::isParallel(options, options.sweepOptions) };
+	std::chrono::steady_clock::time_point const start{ std::chrono::steady_clock::now() };
+	std::vector<SweepRun> const runs{ ParameterSweep::run(options, options.sweepOptions) };
+	Milliseconds const wallTime{ std::chrono::steady_clock::now() - start };
+
+	std::cout << std::right << std::setw(7) << "Config"
+			  << std::setw(7) << "N"
+			  << std::setw(7) << "F"
+			  << std::setw(7) << "CR" << "  "
+			  << std::left << std::setw(28) << "Mutation"
+			  << std::setw(28) << "Croisement" << std::right
+			  << std::setw(8) << "Germe"
+			  << std::setw(8) << "Gén."
+			  << std::setw(16) << "Objective"
+			  << std::setw(12) << "Éval. cible"
+			  << std::setw(12) << "Temps (ms)" << '\n';
+	for (SweepRun const & run : runs) {
+		std::cout << std::right << std::setw(7) << run.configuration;
+		if (!run.error.empty()) {
+			std::cout << "  erreur (germe " << run.seed << ") : " << run.error << '\n';
+			continue;
+		}
+		std::cout << std::setw(7) << run.populationSize
+				  << std::fixed << std::setprecision(2)
+				  << std::setw(7) << run.mutationFactor
+				  << std::setw(7) << run.crossoverRate << "  " << std::defaultfloat
+				  << std::left << std::setw(28) << run.mutation
+				  << std::setw(28) << run.crossover << std::right
+				  << std::setw(8) << run.seed
+				  << std::setw(8) << run.generationCount
+				  << std::setw(16) << run.bestObjective
+				  << std::setw(12) << (run.evaluationsToTarget ? std::to_string(*run.evaluationsToTarget) : std::string("-"))
+				  << std::fixed << std::setprecision(1)
+				  << std::setw(12) << Milliseconds(run.timing.wallTime).count()
+				  << std::defaultfloat << '\n';
+	}
+	std::cout << "\nSimulations          : " << runs.size() << (parallel ? " (en parallèle)" : " (séquentielles)") << '\n'
+			  << "Temps réel total     : " << wallTime.count() << " ms\n";
+}
+
+static void printResult(RunResult const & result)
+{
+	using Milliseconds = std::chrono::duration<double, std::milli>;
+	double const wallSeconds{ std::chrono::duration<double>(result.timing.wallTime).count() };
+
+	std::cout << "Problème              : " << result.problem << '\n'
+			  << "Taille de population  : " << result.populationSize << '\n';
+	if (result.islandCount > 1) {
+		std::cout << "Îles                  : " << result.islandCount << (result.parallelIslands ? " (en parallèle)" : " (séquentielles)") << '\n'
+				  << "Migrants envoyés      : " << result.migrationCount << '\n';
+	}
+	if (result.asyncWorkerCount > 0) {
+		std::cout << "Fils asynchrones      : " << result.asyncWorkerCount << '\n'
+				  << "Remplacements         : " << result.replacementCount << '\n';
+	}
+	std::cout << "Générations           : " << result.generationCount << '\n'
+			  << "Évaluations           : " << result.timing.evaluationCount << '\n'
+			  << "Temps réel            : " << Milliseconds(result.timing.wallTime).count() << " ms\n"
+			  << "Temps processeur      : " << Milliseconds(result.timing.cpuTime).count() << " ms\n";
+	if (wallSeconds > 0.0) {
+		std::cout << "Générations / s       : " << result.timing.generationCount / wallSeconds << '\n'
+				  << "Évaluations / s       : " << result.timing.evaluationCount / wallSeconds << '\n';
+	}
+	std::cout << "Meilleure objective   : " << result.bestObjective << '\n'
+			  << "Meilleure fitness     : " << result.bestFitness << '\n'
+			  << "Fitness moyenne       : " << result.fitnessStatistics.average() << '\n'
+			  << "Écart type fitness    : " << result.fitnessStatistics.stdev() << '\n'
+			  << "Meilleure solution    : " << result.bestSolutionInfo << '\n';
+}
+
+int main(int argc, char * argv[])
+{
+#ifdef _WIN32
+	// the sources and the messages are encoded in UTF-8
+	SetConsoleOutputCP(CP_UTF8);
+#endif
+
+	try {
+		RunnerOptions const options{ RunnerOptions::parse(std::vector<std::string>(argv + 1, argv + argc)) };
+		if (options.help) {
+			std::cout << RunnerOptions::usage();
+			return 0;
+		}
+
+		if (options.benchmark) {
+			runBenchmark(options.benchmarkOptions);
+		} else if (options.sweep) {
+			runSweep(options);
+		} else {
+			printResult(HeadlessRunner::run(options));
+		}
+	} catch (std::exception const & exception) {
+		std::cerr << exception.what() << "\n\n" << RunnerOptions::usage();
+		return 1;
+	}
+
+	return 0;
+}